@@ -28,6 +28,7 @@
 #include "Types.h"
 #include "Util/Math.h"
 #include "Util/Logger.h"
+#include "Util/Profiler.h"
 #include "Util/Util.h"
 
 
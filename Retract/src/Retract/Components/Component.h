@@ -23,6 +23,7 @@
 #pragma once
 
 #include "Retract/Common.h"
+#include "Retract/Util/Pool.h"
 
 namespace retract
 {
@@ -31,11 +32,14 @@ class Entity;
 class Component
 {
 public:
+    RETRACT_POOL_ALLOCATED
+
     explicit Component(Entity* owner, i32 update_order = 100);
     virtual ~Component();
 
     virtual void Update(f32 delta);
     virtual void ProcessInput(const u8* key_state) {}
+    // Called on the main thread after transform::Update rebuilt the owner's world matrix
     virtual void OnUpdateWorldTransform() {}
 
     [[nodiscard]] constexpr i32 UpdateOrder() const { return mUpdateOrder; }
@@ -43,5 +47,11 @@ public:
 protected:
     Entity* mOwner{ nullptr };
     i32     mUpdateOrder{};
+
+private:
+    friend class Entity;
+
+    // Next in the owner's list, which is kept in update order
+    Component* mNextComponent{ nullptr };
 };
 } // namespace retract
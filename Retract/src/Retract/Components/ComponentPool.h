@@ -0,0 +1,110 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: ComponentPool.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Retract/Common.h"
+
+namespace retract::ecs
+{
+
+// Sparse set of T. Component data lives densely packed in mData so systems can walk it linearly,
+// the ids handed out by Add stay valid until Remove no matter how the dense array is shuffled.
+template<typename T>
+class ComponentPool
+{
+public:
+    using id_type = u32;
+
+    template<typename... Args>
+    id_type Add(Args&&... args)
+    {
+        id_type id;
+        if (!mFreeIds.empty())
+        {
+            id = mFreeIds.back();
+            mFreeIds.pop_back();
+        } else
+        {
+            id = (id_type) mSparse.size();
+            mSparse.emplace_back(u32_invalid_id);
+        }
+
+        mSparse[id] = (u32) mData.size();
+        mData.emplace_back(std::forward<Args>(args)...);
+        mIds.emplace_back(id);
+        return id;
+    }
+
+    // Swap and pop, the last element takes the removed element's place
+    void Remove(id_type id)
+    {
+        assert(Contains(id));
+        const u32 index = mSparse[id];
+        const u32 last  = (u32) mData.size() - 1;
+        if (index != last)
+        {
+            mData[index]         = std::move(mData[last]);
+            mIds[index]          = mIds[last];
+            mSparse[mIds[index]] = index;
+        }
+
+        mData.pop_back();
+        mIds.pop_back();
+        mSparse[id] = u32_invalid_id;
+        mFreeIds.emplace_back(id);
+    }
+
+    [[nodiscard]] bool Contains(id_type id) const { return id < mSparse.size() && mSparse[id] != u32_invalid_id; }
+
+    T& operator[](id_type id)
+    {
+        assert(Contains(id));
+        return mData[mSparse[id]];
+    }
+
+    const T& operator[](id_type id) const
+    {
+        assert(Contains(id));
+        return mData[mSparse[id]];
+    }
+
+    [[nodiscard]] u32            Size() const { return (u32) mData.size(); }
+    [[nodiscard]] bool           Empty() const { return mData.empty(); }
+
+    [[nodiscard]] T*                          Data() { return mData.data(); }
+    [[nodiscard]] const utl::vector<id_type>& Ids() const { return mIds; }
+
+    auto begin() { return mData.begin(); }
+    auto end() { return mData.end(); }
+    auto begin() const { return mData.begin(); }
+    auto end() const { return mData.end(); }
+
+private:
+    utl::vector<T>       mData{};
+    utl::vector<id_type> mIds{};    // dense index -> id
+    utl::vector<u32>     mSparse{}; // id -> dense index
+    utl::vector<id_type> mFreeIds{};
+};
+
+} // namespace retract::ecs
@@ -29,37 +29,95 @@
 namespace retract
 {
 
+namespace
+{
+// Slot per live entity for handle lookups. A slot's generation goes up when its entity dies, which
+// invalidates every handle to it before the slot is reused
+utl::vector<Entity*> handle_slots{};
+utl::vector<u32>     handle_generations{};
+utl::vector<u32>     free_handles{};
+
+EntityHandle AddHandle(Entity* entity)
+{
+    u32 index;
+    if (!free_handles.empty())
+    {
+        index = free_handles.back();
+        free_handles.pop_back();
+        handle_slots[index] = entity;
+    } else
+    {
+        index = (u32) handle_slots.size();
+        handle_slots.emplace_back(entity);
+        handle_generations.emplace_back(0);
+    }
+
+    return { index, handle_generations[index] };
+}
+
+void RemoveHandle(EntityHandle handle)
+{
+    handle_slots[handle.index] = nullptr;
+    ++handle_generations[handle.index];
+    free_handles.emplace_back(handle.index);
+}
+} // anonymous namespace
+
 Entity::Entity() : mState{ State::active }
 {
+    mTransformId = transform::Add(this);
+    mHandle      = AddHandle(this);
     Game::Instance()->AddEntity(this);
 }
 
 Entity::~Entity()
 {
     Game::Instance()->RemoveEntity(this);
-    while (!mComponents.empty())
+    while (mComponents)
+    {
+        // Unlinks itself through RemoveComponent
+        delete mComponents;
+    }
+
+    for (u32 child = transform::FirstChild(mTransformId); child != u32_invalid_id; child = transform::NextSibling(child))
     {
-        auto& comp = mComponents.back();
-        delete comp;
-        comp = nullptr;
+        transform::Owner(child)->SetState(State::dead);
     }
+    transform::Remove(mTransformId);
+    RemoveHandle(mHandle);
+}
+
+void Entity::SetState(State state)
+{
+    if (state == State::dead && mState != State::dead)
+    {
+        Game::Instance()->QueueDestroy(this);
+    }
+    mState = state;
+}
+
+Entity* Entity::Resolve(EntityHandle handle)
+{
+    if (handle.index >= handle_slots.size() || handle_generations[handle.index] != handle.generation)
+    {
+        return nullptr;
+    }
+
+    return handle_slots[handle.index];
 }
 void Entity::Update(f32 delta)
 {
     if (mState != State::active)
         return;
 
-    CalculateWorldTransform();
-
+    // World transforms are recalculated by transform::Update in batches around this
     UpdateComponents(delta);
     UpdateEntity(delta);
-
-    CalculateWorldTransform();
 }
 
 void Entity::UpdateComponents(f32 delta) const
 {
-    for (auto* comp : mComponents)
+    for (Component* comp = mComponents; comp; comp = comp->mNextComponent)
     {
         comp->Update(delta);
     }
@@ -69,7 +127,7 @@ void Entity::ProcessInput(const u8* key_state)
     if (mState != State::active)
         return;
 
-    for (const auto comp : mComponents)
+    for (Component* comp = mComponents; comp; comp = comp->mNextComponent)
     {
         comp->ProcessInput(key_state);
     }
@@ -80,38 +138,45 @@ void Entity::ProcessInput(const u8* key_state)
 
 void Entity::AddComponent(Component* comp)
 {
-    const i32  order = comp->UpdateOrder();
-    auto it    = mComponents.begin();
-    while (it != mComponents.end())
+    // After any components with the same order
+    const i32   order = comp->UpdateOrder();
+    Component** link  = &mComponents;
+    while (*link && (*link)->UpdateOrder() <= order)
     {
-        if (order < (*it)->UpdateOrder())
-            break;
-        ++it;
+        link = &(*link)->mNextComponent;
     }
 
-    mComponents.insert(it, comp);
+    comp->mNextComponent = *link;
+    *link                = comp;
 }
 
 void Entity::RemoveComponent(Component* comp)
 {
-    if (const auto it = std::ranges::find(mComponents, comp); it != mComponents.end())
+    for (Component** link = &mComponents; *link; link = &(*link)->mNextComponent)
     {
-        mComponents.erase(it);
+        if (*link == comp)
+        {
+            *link                = comp->mNextComponent;
+            comp->mNextComponent = nullptr;
+            return;
+        }
     }
 }
 
-void Entity::CalculateWorldTransform()
+void Entity::SetParent(const Entity* parent)
 {
-    if (!mRecalculateTransform)
-        return;
+    transform::SetParent(mTransformId, parent ? parent->mTransformId : u32_invalid_id);
+}
 
-    mRecalculateTransform = false;
-    // Scale, rotate, translate
-    mWorldTransform = math::Scale(mScale);
-    mWorldTransform *= math::FromQuaternion(mRotation);
-    mWorldTransform *= math::Translation(mPosition);
+Entity* Entity::Parent() const
+{
+    const u32 parent = transform::Parent(mTransformId);
+    return parent != u32_invalid_id ? transform::Owner(parent) : nullptr;
+}
 
-    for (const auto comp : mComponents)
+void Entity::OnUpdateWorldTransform() const
+{
+    for (Component* comp = mComponents; comp; comp = comp->mNextComponent)
     {
         comp->OnUpdateWorldTransform();
     }
@@ -23,6 +23,8 @@
 #pragma once
 
 #include "Retract/Common.h"
+#include "Retract/Util/Pool.h"
+#include "Transform.h"
 
 namespace retract
 {
@@ -30,6 +32,15 @@ namespace retract
 
 class Component;
 
+// Weak reference to an entity. Resolves to nullptr once the entity is destroyed, even after its slot is reused
+struct EntityHandle
+{
+    u32 index{ u32_invalid_id };
+    u32 generation{};
+
+    constexpr bool operator==(const EntityHandle&) const = default;
+};
+
 class Entity
 {
 public:
@@ -40,9 +51,14 @@ public:
         dead
     };
 
+    RETRACT_POOL_ALLOCATED
+
     explicit Entity();
     virtual ~Entity();
 
+    constexpr EntityHandle Handle() const { return mHandle; }
+    static Entity*         Resolve(EntityHandle handle);
+
     void Update(f32 delta);
     void UpdateComponents(f32 delta) const;
 
@@ -55,44 +71,46 @@ public:
     void RemoveComponent(Component* comp);
 
     constexpr State CurrentState() const { return mState; }
-    void            SetState(State state) { mState = state; }
+    // Going dead queues the entity for deletion at the end of the frame's ticks
+    void            SetState(State state);
 
 
-    void                        CalculateWorldTransform();
-    constexpr const mat4&       WorldTransform() const { return mWorldTransform; }
-    constexpr const vec3&       Position() const { return mPosition; }
-    constexpr f32               Scale() const { return mScale; }
-    constexpr const quaternion& Rotation() const { return mRotation; }
+    // Called by transform::Update once the world matrix has been rebuilt
+    void OnUpdateWorldTransform() const;
 
-    void SetPosition(const vec3& pos)
-    {
-        mPosition             = pos;
-        mRecalculateTransform = true;
-    }
-    void SetScale(const f32 scale)
-    {
-        mScale                = scale;
-        mRecalculateTransform = true;
-    }
-    void SetRotation(const quaternion& rotation)
-    {
-        mRotation             = rotation;
-        mRecalculateTransform = true;
-    }
+    // Position, rotation and scale become relative to the parent. Attached entities die with their parent
+    void    SetParent(const Entity* parent);
+    Entity* Parent() const;
 
-    vec3 Forward() const { return math::Transform(math::unitx_vec3, mRotation); }
+    constexpr u32     TransformId() const { return mTransformId; }
+    const mat4&       WorldTransform() const { return transform::World(mTransformId); }
+    // Interpolated between the last two simulation ticks, what the renderer draws
+    const mat4&       RenderTransform() const { return transform::Render(mTransformId); }
+    const vec3&       Position() const { return transform::Position(mTransformId); }
+    f32               Scale() const { return transform::Scale(mTransformId); }
+    const quaternion& Rotation() const { return transform::Rotation(mTransformId); }
+    vec3              WorldPosition() const { return WorldTransform().Translation(); }
+
+    void SetPosition(const vec3& pos) { transform::SetPosition(mTransformId, pos); }
+    void SetScale(const f32 scale) { transform::SetScale(mTransformId, scale); }
+    void SetRotation(const quaternion& rotation) { transform::SetRotation(mTransformId, rotation); }
+
+    vec3 Forward() const { return math::Transform(math::unitx_vec3, Rotation()); }
 
 
 private:
-    State                   mState;
-    utl::vector<Component*> mComponents;
+    friend class Game;
+
+    State      mState;
+    // Intrusive list through Component::mNextComponent, sorted by update order
+    Component* mComponents{ nullptr };
 
-    mat4 mWorldTransform{};
-    bool mRecalculateTransform{ true };
+    u32          mTransformId{ u32_invalid_id };
+    EntityHandle mHandle{};
 
-    vec3       mPosition{};
-    f32        mScale{ 1.f };
-    quaternion mRotation{};
+    // Slot in Game's entity list, or its pending list while mPendingAdd
+    u32  mListIndex{ u32_invalid_id };
+    bool mPendingAdd{ false };
 };
 
 } // namespace retract
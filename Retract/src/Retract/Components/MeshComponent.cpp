@@ -24,37 +24,18 @@
 #include "MeshComponent.h"
 
 #include "Entity.h"
-#include "Retract/Graphics/Renderer.h"
 
 namespace retract
 {
 
 MeshComponent::MeshComponent(Entity* owner) : Component{owner}
 {
-    graphics::AddMesh(this);
+    mId = ecs::MeshPool().Add(ecs::MeshData{ owner });
 }
 
 MeshComponent::~MeshComponent()
 {
-    graphics::RemoveMesh(this);
-}
-
-void MeshComponent::Draw(Shader* shader)
-{
-    if(!mMesh) return;
-
-    shader->SetMatrix("WorldTransform", mOwner->WorldTransform());
-    shader->SetFloat("SpecularPower", mMesh->SpecularPower());
-
-    if (const Texture* t = mMesh->GetTexture(mTextureIndex))
-    {
-        t->Activate();
-    }
-
-    const VertexArray* vao = mMesh->GetVertexArray();
-    vao->Activate();
-
-    graphics::DrawIndexed((i32)vao->NumIndices());
+    ecs::MeshPool().Remove(mId);
 }
 
 }
\ No newline at end of file
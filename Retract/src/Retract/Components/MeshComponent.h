@@ -24,8 +24,8 @@
 #pragma once
 
 #include "Component.h"
+#include "Systems.h"
 #include "Retract/Graphics/Mesh.h"
-#include "Retract/Graphics/Shader.h"
 
 namespace retract
 {
@@ -36,14 +36,14 @@ public:
     MeshComponent(Entity* owner);
     ~MeshComponent() override;
 
-    virtual void Draw(Shader* shader);
+    virtual void SetMesh(Mesh* mesh) { ecs::MeshPool()[mId].mesh = mesh; }
+    void         SetTextureIndex(u32 index) { ecs::MeshPool()[mId].texture_index = index; }
 
-    virtual void SetMesh(Mesh* mesh) { mMesh = mesh; }
-    void SetTextureIndex(u32 index) { mTextureIndex = index; }
+    Mesh* GetMesh() const { return ecs::MeshPool()[mId].mesh; }
+    u32   TextureIndex() const { return ecs::MeshPool()[mId].texture_index; }
 
 private:
-    Mesh* mMesh{};
-    u32 mTextureIndex{};
+    u32 mId{ u32_invalid_id };
 };
 
 }
\ No newline at end of file
@@ -27,31 +27,23 @@
 
 #include "Entity.h"
 
+#include <algorithm>
+
 
 namespace retract
 {
 
-void MoveComponent::Update(f32 delta)
+MoveComponent::MoveComponent(Entity* owner, i32 update_order) : Component(owner, update_order)
+{
+    // ecs::UpdateMovement writes the owner's transform from worker threads, two records for one entity could race
+    assert(std::ranges::none_of(ecs::MovePool(), [owner](const ecs::MoveData& move) { return move.owner == owner; }) &&
+           "An entity can only have one MoveComponent");
+    mId = ecs::MovePool().Add(ecs::MoveData{ owner });
+}
+
+MoveComponent::~MoveComponent()
 {
-    if (!math::NearZero(mAngularSpeed))
-    {
-        quaternion rot   = mOwner->Rotation();
-        const f32  angle = mAngularSpeed * delta;
-
-        // Incremental rotation about up axis
-        const quaternion inc{ math::unitz_vec3, angle };
-
-        // concat old and new rotation
-        rot = math::Concatinate(rot, inc);
-        mOwner->SetRotation(rot);
-    }
-
-    if (!math::NearZero(mForwardSpeed))
-    {
-        vec3 pos = mOwner->Position();
-        pos += mOwner->Forward() * mForwardSpeed * delta;
-        mOwner->SetPosition(pos);
-    }
+    ecs::MovePool().Remove(mId);
 }
 
 } // namespace retract
\ No newline at end of file
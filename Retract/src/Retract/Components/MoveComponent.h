@@ -24,24 +24,26 @@
 #pragma once
 
 #include "Component.h"
+#include "Systems.h"
 
 namespace retract
 {
 class MoveComponent : public Component
 {
 public:
-    MoveComponent(Entity* owner, i32 update_order = 10) : Component(owner, update_order) {}
-    void Update(f32 delta) override;
+    // At most one per entity, asserted
+    MoveComponent(Entity* owner, i32 update_order = 10);
+    ~MoveComponent() override;
 
-    void SetAngularSpeed(f32 speed) { mAngularSpeed = speed; }
-    void SetForwardSpeed(f32 speed) { mForwardSpeed = speed; }
+    // Movement is applied by ecs::UpdateMovement, not per component
+    void SetAngularSpeed(f32 speed) { ecs::MovePool()[mId].angular_speed = speed; }
+    void SetForwardSpeed(f32 speed) { ecs::MovePool()[mId].forward_speed = speed; }
 
-    constexpr f32 AngularSpeed() const { return mAngularSpeed; }
-    constexpr f32 ForwardSpeed() const { return mForwardSpeed; }
+    f32 AngularSpeed() const { return ecs::MovePool()[mId].angular_speed; }
+    f32 ForwardSpeed() const { return ecs::MovePool()[mId].forward_speed; }
 
 private:
-    f32 mAngularSpeed{};
-    f32 mForwardSpeed{};
+    u32 mId{ u32_invalid_id };
 };
 
 } // namespace retract
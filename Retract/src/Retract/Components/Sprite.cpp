@@ -26,53 +26,31 @@
 #include "Entity.h"
 #include "Retract/Core/Game.h"
 #include "Retract/Core/Resources.h"
-#include "Retract/Graphics/Renderer.h"
 
 namespace retract
 {
 
 
-Sprite::Sprite(Entity* owner, i32 draw_order) : Component{ owner }, mDrawOrder{ draw_order }
+Sprite::Sprite(Entity* owner, i32 draw_order) : Component{ owner }
 {
-    graphics::AddSprite(this);
+    mId = ecs::SpritePool().Add(ecs::SpriteData{ .owner = owner, .draw_order = draw_order });
 }
 
 Sprite::~Sprite()
 {
-    graphics::RemoveSprite(this);
-}
-
-void Sprite::Draw(Shader* shader)
-{
-    if (!mTexture)
-        return;
-
-    const mat4 scale = math::Scale((f32) mWidth, (f32) mHeight, 1.f);
-    const mat4 world = scale * mOwner->WorldTransform();
-
-    // All sprites use the same shader, so the shader is set active elsewhere
-
-    shader->SetMatrix("WorldTransform", world);
-    mTexture->Activate();
-
-    graphics::DrawIndexed(6);
+    ecs::SpritePool().Remove(mId);
 }
 
 void Sprite::SetTexture(Texture* texture)
 {
-    mTexture = texture;
-    mWidth   = texture->Width();
-    mHeight  = texture->Height();
+    ecs::SpriteData& data = ecs::SpritePool()[mId];
+    data.texture          = texture;
 }
 
 void Sprite::SetTexture(const char* filename)
 {
-    mTexture = core::GetTexture(filename);
-    if (mTexture)
-    {
-        mWidth  = mTexture->Width();
-        mHeight = mTexture->Height();
-    }
+    ecs::SpriteData& data = ecs::SpritePool()[mId];
+    data.texture          = core::GetTexture(filename);
 }
 
 
@@ -24,7 +24,7 @@
 
 #include "Retract/Common.h"
 #include "Component.h"
-#include "Retract/Graphics/Shader.h"
+#include "Systems.h"
 #include "Retract/Graphics/Texture.h"
 
 namespace retract
@@ -37,19 +37,24 @@ public:
     Sprite(Entity* owner, i32 draw_order = 100);
     ~Sprite() override;
 
-    virtual void Draw(Shader* shader);
     virtual void SetTexture(Texture* texture);
     virtual void SetTexture(const char* filename);
 
-    [[nodiscard]] constexpr i32 DrawOrder() const { return mDrawOrder; }
-    [[nodiscard]] constexpr i32 Width() const { return mWidth; }
-    [[nodiscard]] constexpr i32 Height() const { return mHeight; }
+    [[nodiscard]] i32 DrawOrder() const { return ecs::SpritePool()[mId].draw_order; }
+    // Taken from the texture so a sprite resizes itself when an async load replaces the placeholder
+    [[nodiscard]] i32 Width() const
+    {
+        const Texture* texture = ecs::SpritePool()[mId].texture;
+        return texture ? texture->Width() : 0;
+    }
+    [[nodiscard]] i32 Height() const
+    {
+        const Texture* texture = ecs::SpritePool()[mId].texture;
+        return texture ? texture->Height() : 0;
+    }
 
 protected:
-    i32      mDrawOrder{ 100 };
-    Texture* mTexture{ nullptr };
-    i32      mWidth{ 0 };
-    i32      mHeight{ 0 };
+    u32 mId{ u32_invalid_id };
 };
 
 class AnimatedSprite : public Sprite
@@ -0,0 +1,87 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Systems.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "Systems.h"
+
+#include "Entity.h"
+#include "Retract/Core/Jobs.h"
+
+namespace retract::ecs
+{
+
+namespace
+{
+ComponentPool<MoveData>   move_pool{};
+ComponentPool<MeshData>   mesh_pool{};
+ComponentPool<SpriteData> sprite_pool{};
+
+constexpr u32 move_batch_size = 256;
+} // anonymous namespace
+
+ComponentPool<MoveData>& MovePool()
+{
+    return move_pool;
+}
+
+ComponentPool<MeshData>& MeshPool()
+{
+    return mesh_pool;
+}
+
+ComponentPool<SpriteData>& SpritePool()
+{
+    return sprite_pool;
+}
+
+// MoveComponent allows one per entity, so each record is the only writer of its owner's transform and batches can
+// run on any worker
+void UpdateMovement(f32 delta)
+{
+    PROFILE_FUNCTION();
+    const MoveData* moves = move_pool.Data();
+    jobs::ParallelFor(move_pool.Size(), move_batch_size, [moves, delta](u32 begin, u32 end) {
+        for (u32 i = begin; i < end; ++i)
+        {
+            const MoveData& move  = moves[i];
+            Entity*         owner = move.owner;
+            if (owner->CurrentState() != Entity::State::active)
+                continue;
+
+            if (!math::NearZero(move.angular_speed))
+            {
+                // Incremental rotation about up axis
+                const quaternion inc{ math::unitz_vec3, move.angular_speed * delta };
+
+                // concat old and new rotation
+                owner->SetRotation(math::Concatinate(owner->Rotation(), inc));
+            }
+
+            if (!math::NearZero(move.forward_speed))
+            {
+                owner->SetPosition(owner->Position() + owner->Forward() * move.forward_speed * delta);
+            }
+        }
+    });
+}
+
+} // namespace retract::ecs
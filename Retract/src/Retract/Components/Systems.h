@@ -0,0 +1,69 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Systems.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "ComponentPool.h"
+
+namespace retract
+{
+class Entity;
+class Mesh;
+class Texture;
+} // namespace retract
+
+namespace retract::ecs
+{
+
+// Packed data behind the built in components. MoveComponent, MeshComponent and Sprite are thin
+// facades holding an id into one of these pools, the per frame work is done by the systems below
+
+struct MoveData
+{
+    Entity* owner{};
+    f32     angular_speed{};
+    f32     forward_speed{};
+};
+
+struct MeshData
+{
+    Entity* owner{};
+    Mesh*   mesh{};
+    u32     texture_index{};
+    u32     lod{}; // level drawn last frame, the renderer's selection starts from it
+};
+
+struct SpriteData
+{
+    Entity*  owner{};
+    Texture* texture{};
+    i32      draw_order{ 100 };
+};
+
+ComponentPool<MoveData>&   MovePool();
+ComponentPool<MeshData>&   MeshPool();
+ComponentPool<SpriteData>& SpritePool();
+
+void UpdateMovement(f32 delta);
+
+} // namespace retract::ecs
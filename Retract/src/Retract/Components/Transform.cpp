@@ -0,0 +1,550 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Transform.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "Transform.h"
+
+#include "Entity.h"
+#include "Retract/Core/Jobs.h"
+
+#include <algorithm>
+
+namespace retract::transform
+{
+
+namespace
+{
+utl::vector<vec3>       positions{};
+utl::vector<quaternion> rotations{};
+utl::vector<f32>        scales{};
+utl::vector<mat4>       world_transforms{};
+utl::vector<Entity*>    owners{};
+utl::vector<u8>         dirty{};
+utl::vector<u32>        parents{};
+utl::vector<u32>        first_children{};
+utl::vector<u32>        next_siblings{};
+utl::vector<u32>        depths{};
+utl::vector<u32>        free_ids{};
+utl::vector<u32>        updated{};
+
+// Fixed timestep interpolation: locals as they were at the start of the current tick, what happened to
+// each id during it, and the blended matrices the renderer reads
+enum class TickState : u8
+{
+    unchanged,
+    blend,
+    snap, // Added during the tick, there's nothing to blend from
+};
+
+utl::vector<vec3>       prev_positions{};
+utl::vector<quaternion> prev_rotations{};
+utl::vector<f32>        prev_scales{};
+utl::vector<TickState>  tick_states{};
+utl::vector<vec3>       blend_positions{};
+utl::vector<quaternion> blend_rotations{};
+utl::vector<f32>        blend_scales{};
+utl::vector<mat4>       render_transforms{};
+utl::vector<u32>        blended{};
+
+// Live ids sorted by depth, rebuilt lazily when the hierarchy changes
+utl::vector<u32> order{};
+bool             order_dirty{ false };
+
+constexpr u32 batch_size = 256;
+
+// Local transforms and the matrices composed from them, either the simulation state or the blended one
+struct Locals
+{
+    const vec3*       positions;
+    const quaternion* rotations;
+    const f32*        scales;
+    mat4*             matrices;
+};
+
+// Same result as Scale(s) * FromQuaternion(q) * Translation(p) without the two matrix products:
+// the rotation rows are scaled and the translation becomes the last row
+void Compose(const Locals& locals, u32 id)
+{
+    const quaternion& q = locals.rotations[id];
+    const vec3&       p = locals.positions[id];
+    const f32         s = locals.scales[id];
+    mat4&             m = locals.matrices[id];
+
+    m.mat[0][0] = s * (1.f - 2.f * q.y * q.y - 2.f * q.z * q.z);
+    m.mat[0][1] = s * (2.f * q.x * q.y + 2.f * q.w * q.z);
+    m.mat[0][2] = s * (2.f * q.x * q.z - 2.f * q.w * q.y);
+    m.mat[0][3] = 0.f;
+
+    m.mat[1][0] = s * (2.f * q.x * q.y - 2.f * q.w * q.z);
+    m.mat[1][1] = s * (1.f - 2.f * q.x * q.x - 2.f * q.z * q.z);
+    m.mat[1][2] = s * (2.f * q.y * q.z + 2.f * q.w * q.x);
+    m.mat[1][3] = 0.f;
+
+    m.mat[2][0] = s * (2.f * q.x * q.z + 2.f * q.w * q.y);
+    m.mat[2][1] = s * (2.f * q.y * q.z - 2.f * q.w * q.x);
+    m.mat[2][2] = s * (1.f - 2.f * q.x * q.x - 2.f * q.y * q.y);
+    m.mat[2][3] = 0.f;
+
+    m.mat[3][0] = p.x;
+    m.mat[3][1] = p.y;
+    m.mat[3][2] = p.z;
+    m.mat[3][3] = 1.f;
+}
+
+#if RETRACT_SIMD_SSE
+// Four transforms at once, one per lane. The inputs are gathered into lanes, the matrix terms are
+// computed lane wise and a transpose per row turns them back into four row major matrices
+void Compose4(const Locals& locals, const u32* ids)
+{
+    const quaternion* rotations = locals.rotations;
+    const vec3*       positions = locals.positions;
+    const f32*        scales    = locals.scales;
+
+    const __m128 qx = _mm_setr_ps(rotations[ids[0]].x, rotations[ids[1]].x, rotations[ids[2]].x, rotations[ids[3]].x);
+    const __m128 qy = _mm_setr_ps(rotations[ids[0]].y, rotations[ids[1]].y, rotations[ids[2]].y, rotations[ids[3]].y);
+    const __m128 qz = _mm_setr_ps(rotations[ids[0]].z, rotations[ids[1]].z, rotations[ids[2]].z, rotations[ids[3]].z);
+    const __m128 qw = _mm_setr_ps(rotations[ids[0]].w, rotations[ids[1]].w, rotations[ids[2]].w, rotations[ids[3]].w);
+    const __m128 s  = _mm_setr_ps(scales[ids[0]], scales[ids[1]], scales[ids[2]], scales[ids[3]]);
+
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 two = _mm_set1_ps(2.f);
+
+    const __m128 x2 = _mm_mul_ps(two, qx);
+    const __m128 y2 = _mm_mul_ps(two, qy);
+    const __m128 z2 = _mm_mul_ps(two, qz);
+
+    const __m128 xx = _mm_mul_ps(x2, qx);
+    const __m128 yy = _mm_mul_ps(y2, qy);
+    const __m128 zz = _mm_mul_ps(z2, qz);
+    const __m128 xy = _mm_mul_ps(x2, qy);
+    const __m128 xz = _mm_mul_ps(x2, qz);
+    const __m128 yz = _mm_mul_ps(y2, qz);
+    const __m128 wx = _mm_mul_ps(x2, qw);
+    const __m128 wy = _mm_mul_ps(y2, qw);
+    const __m128 wz = _mm_mul_ps(z2, qw);
+
+    __m128 r00 = _mm_mul_ps(s, _mm_sub_ps(_mm_sub_ps(one, yy), zz));
+    __m128 r01 = _mm_mul_ps(s, _mm_add_ps(xy, wz));
+    __m128 r02 = _mm_mul_ps(s, _mm_sub_ps(xz, wy));
+    __m128 r10 = _mm_mul_ps(s, _mm_sub_ps(xy, wz));
+    __m128 r11 = _mm_mul_ps(s, _mm_sub_ps(_mm_sub_ps(one, xx), zz));
+    __m128 r12 = _mm_mul_ps(s, _mm_add_ps(yz, wx));
+    __m128 r20 = _mm_mul_ps(s, _mm_add_ps(xz, wy));
+    __m128 r21 = _mm_mul_ps(s, _mm_sub_ps(yz, wx));
+    __m128 r22 = _mm_mul_ps(s, _mm_sub_ps(_mm_sub_ps(one, xx), yy));
+    __m128 px  = _mm_setr_ps(positions[ids[0]].x, positions[ids[1]].x, positions[ids[2]].x, positions[ids[3]].x);
+    __m128 py  = _mm_setr_ps(positions[ids[0]].y, positions[ids[1]].y, positions[ids[2]].y, positions[ids[3]].y);
+    __m128 pz  = _mm_setr_ps(positions[ids[0]].z, positions[ids[1]].z, positions[ids[2]].z, positions[ids[3]].z);
+    __m128 w0  = _mm_setzero_ps();
+    __m128 w1  = _mm_setzero_ps();
+    __m128 w2  = _mm_setzero_ps();
+    __m128 w3  = one;
+
+    _MM_TRANSPOSE4_PS(r00, r01, r02, w0);
+    _MM_TRANSPOSE4_PS(r10, r11, r12, w1);
+    _MM_TRANSPOSE4_PS(r20, r21, r22, w2);
+    _MM_TRANSPOSE4_PS(px, py, pz, w3);
+
+    const __m128 row0[4]{ r00, r01, r02, w0 };
+    const __m128 row1[4]{ r10, r11, r12, w1 };
+    const __m128 row2[4]{ r20, r21, r22, w2 };
+    const __m128 row3[4]{ px, py, pz, w3 };
+    for (u32 i = 0; i < 4; ++i)
+    {
+        mat4& m = locals.matrices[ids[i]];
+        _mm_store_ps(m.mat[0], row0[i]);
+        _mm_store_ps(m.mat[1], row1[i]);
+        _mm_store_ps(m.mat[2], row2[i]);
+        _mm_store_ps(m.mat[3], row3[i]);
+    }
+}
+#endif
+
+void Unlink(u32 id)
+{
+    const u32 parent = parents[id];
+    if (parent == u32_invalid_id)
+        return;
+
+    u32* link = &first_children[parent];
+    while (*link != id)
+    {
+        link = &next_siblings[*link];
+    }
+    *link             = next_siblings[id];
+    next_siblings[id] = u32_invalid_id;
+    parents[id]       = u32_invalid_id;
+}
+
+void RebuildOrder()
+{
+    order_dirty = false;
+
+    const u32 count     = (u32) owners.size();
+    u32       max_depth = 0;
+    for (u32 id = 0; id < count; ++id)
+    {
+        if (!owners[id])
+            continue;
+
+        u32 depth = 0;
+        for (u32 p = parents[id]; p != u32_invalid_id; p = parents[p])
+        {
+            ++depth;
+        }
+        depths[id] = depth;
+        max_depth  = math::Max(max_depth, depth);
+    }
+
+    // Counting sort by depth, ids stay ascending within a level
+    utl::vector<u32> level_starts(max_depth + 2, 0);
+    for (u32 id = 0; id < count; ++id)
+    {
+        if (owners[id])
+            ++level_starts[depths[id] + 1];
+    }
+    for (u32 d = 1; d < (u32) level_starts.size(); ++d)
+    {
+        level_starts[d] += level_starts[d - 1];
+    }
+
+    order.resize(level_starts.back());
+    for (u32 id = 0; id < count; ++id)
+    {
+        if (owners[id])
+            order[level_starts[depths[id]]++] = id;
+    }
+}
+
+// Ids of one depth only read matrices of the level above, which are already final
+void ApplyParents(const utl::vector<u32>& list, mat4* matrices)
+{
+    const u32* ids   = list.data();
+    const u32  count = (u32) list.size();
+
+    u32 begin = 0;
+    while (begin < count)
+    {
+        const u32 depth = depths[ids[begin]];
+        u32       end   = begin + 1;
+        while (end < count && depths[ids[end]] == depth)
+        {
+            ++end;
+        }
+
+        if (depth > 0)
+        {
+            jobs::ParallelFor(end - begin, batch_size, [ids, begin, matrices](u32 first, u32 last) {
+                for (u32 i = begin + first; i < begin + last; ++i)
+                {
+                    const u32 id = ids[i];
+                    matrices[id] = matrices[id] * matrices[parents[id]];
+                }
+            });
+        }
+        begin = end;
+    }
+}
+
+void ComposeRange(const Locals& locals, const u32* ids, u32 count)
+{
+    u32 i = 0;
+#if RETRACT_SIMD_SSE
+    for (; i + 4 <= count; i += 4)
+    {
+        Compose4(locals, ids + i);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        Compose(locals, ids[i]);
+    }
+}
+} // anonymous namespace
+
+u32 Add(Entity* owner)
+{
+    u32 id;
+    if (!free_ids.empty())
+    {
+        id = free_ids.back();
+        free_ids.pop_back();
+    } else
+    {
+        id = (u32) positions.size();
+        positions.emplace_back();
+        rotations.emplace_back();
+        scales.emplace_back();
+        world_transforms.emplace_back();
+        owners.emplace_back();
+        dirty.emplace_back();
+        parents.emplace_back(u32_invalid_id);
+        first_children.emplace_back(u32_invalid_id);
+        next_siblings.emplace_back(u32_invalid_id);
+        depths.emplace_back();
+        prev_positions.emplace_back();
+        prev_rotations.emplace_back();
+        prev_scales.emplace_back();
+        tick_states.emplace_back();
+        blend_positions.emplace_back();
+        blend_rotations.emplace_back();
+        blend_scales.emplace_back();
+        render_transforms.emplace_back();
+    }
+
+    positions[id] = {};
+    rotations[id] = {};
+    scales[id]    = 1.f;
+    owners[id]    = owner;
+    dirty[id]     = true;
+    depths[id]      = 0;
+    tick_states[id] = TickState::snap;
+    order_dirty     = true;
+    return id;
+}
+
+void Remove(u32 id)
+{
+    assert(id < owners.size() && owners[id]);
+    Unlink(id);
+    while (first_children[id] != u32_invalid_id)
+    {
+        Unlink(first_children[id]);
+    }
+
+    owners[id]  = nullptr;
+    dirty[id]   = false;
+    order_dirty = true;
+    free_ids.emplace_back(id);
+}
+
+void SetParent(u32 id, u32 parent)
+{
+    assert(owners[id] && (parent == u32_invalid_id || owners[parent]));
+    if (parents[id] == parent)
+        return;
+
+#ifdef _DEBUG
+    for (u32 p = parent; p != u32_invalid_id; p = parents[p])
+    {
+        assert(p != id && "Parenting would create a cycle");
+    }
+#endif
+
+    Unlink(id);
+    if (parent != u32_invalid_id)
+    {
+        parents[id]            = parent;
+        next_siblings[id]      = first_children[parent];
+        first_children[parent] = id;
+    }
+
+    dirty[id]   = true;
+    order_dirty = true;
+}
+
+u32 Parent(u32 id)
+{
+    return parents[id];
+}
+
+u32 FirstChild(u32 id)
+{
+    return first_children[id];
+}
+
+u32 NextSibling(u32 id)
+{
+    return next_siblings[id];
+}
+
+Entity* Owner(u32 id)
+{
+    return owners[id];
+}
+
+const vec3& Position(u32 id)
+{
+    return positions[id];
+}
+
+f32 Scale(u32 id)
+{
+    return scales[id];
+}
+
+const quaternion& Rotation(u32 id)
+{
+    return rotations[id];
+}
+
+const mat4& World(u32 id)
+{
+    return world_transforms[id];
+}
+
+void SetPosition(u32 id, const vec3& position)
+{
+    positions[id] = position;
+    dirty[id]     = true;
+}
+
+void SetScale(u32 id, f32 scale)
+{
+    scales[id] = scale;
+    dirty[id]  = true;
+}
+
+void SetRotation(u32 id, const quaternion& rotation)
+{
+    rotations[id] = rotation;
+    dirty[id]     = true;
+}
+
+const mat4* WorldTransforms()
+{
+    return world_transforms.data();
+}
+
+u32 Count()
+{
+    return (u32) world_transforms.size();
+}
+
+void Update()
+{
+    PROFILE_SCOPE("Transform update");
+    if (order_dirty)
+    {
+        RebuildOrder();
+    }
+
+    // Parents come first, so a dirty parent has already been seen when its children are reached.
+    // Flags are cleared afterwards so children can still read them
+    updated.clear();
+    for (const u32 id : order)
+    {
+        const u32 parent = parents[id];
+        if (parent != u32_invalid_id && dirty[parent])
+        {
+            dirty[id] = true;
+        }
+
+        if (dirty[id])
+        {
+            updated.emplace_back(id);
+        }
+    }
+
+    for (const u32 id : updated)
+    {
+        dirty[id] = false;
+        if (tick_states[id] == TickState::unchanged)
+        {
+            tick_states[id] = TickState::blend;
+        }
+    }
+
+    const u32*   ids   = updated.data();
+    const u32    count = (u32) updated.size();
+    const Locals locals{ positions.data(), rotations.data(), scales.data(), world_transforms.data() };
+    jobs::ParallelFor(count, batch_size, [ids, &locals](u32 begin, u32 end) { ComposeRange(locals, ids + begin, end - begin); });
+
+    ApplyParents(updated, world_transforms.data());
+
+    // Callbacks are game code, they run on this thread in depth order once every matrix is final
+    for (const u32 id : updated)
+    {
+        owners[id]->OnUpdateWorldTransform();
+    }
+}
+
+const utl::vector<u32>& Updated()
+{
+    return updated;
+}
+
+void BeginTick()
+{
+    std::ranges::copy(positions, prev_positions.begin());
+    std::ranges::copy(rotations, prev_rotations.begin());
+    std::ranges::copy(scales, prev_scales.begin());
+    std::ranges::fill(tick_states, TickState::unchanged);
+}
+
+void Interpolate(f32 alpha)
+{
+    PROFILE_SCOPE("Transform interpolate");
+    if (order_dirty)
+    {
+        RebuildOrder();
+    }
+
+    // Whatever didn't change during the last tick renders exactly where it is
+    std::ranges::copy(world_transforms, render_transforms.begin());
+
+    // Update marked the subtrees of changed parents as well, so children are always in here with them
+    blended.clear();
+    for (const u32 id : order)
+    {
+        if (tick_states[id] != TickState::unchanged)
+        {
+            blended.emplace_back(id);
+        }
+    }
+
+    const u32*   ids   = blended.data();
+    const u32    count = (u32) blended.size();
+    const Locals locals{ blend_positions.data(), blend_rotations.data(), blend_scales.data(), render_transforms.data() };
+    jobs::ParallelFor(count, batch_size, [ids, &locals, alpha](u32 begin, u32 end) {
+        for (u32 i = begin; i < end; ++i)
+        {
+            const u32 id = ids[i];
+            if (tick_states[id] == TickState::snap)
+            {
+                blend_positions[id] = positions[id];
+                blend_rotations[id] = rotations[id];
+                blend_scales[id]    = scales[id];
+            } else
+            {
+                blend_positions[id] = math::Lerp(prev_positions[id], positions[id], alpha);
+                blend_rotations[id] = math::Slerp(prev_rotations[id], rotations[id], alpha);
+                blend_scales[id]    = math::Lerp(prev_scales[id], scales[id], alpha);
+            }
+        }
+        ComposeRange(locals, ids + begin, end - begin);
+    });
+
+    ApplyParents(blended, render_transforms.data());
+}
+
+const mat4* RenderTransforms()
+{
+    return render_transforms.data();
+}
+
+const mat4& Render(u32 id)
+{
+    return render_transforms[id];
+}
+
+} // namespace retract::transform
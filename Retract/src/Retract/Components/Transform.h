@@ -0,0 +1,87 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Transform.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Retract/Common.h"
+
+namespace retract
+{
+class Entity;
+} // namespace retract
+
+namespace retract::transform
+{
+
+// Position, rotation and scale for every entity live in parallel arrays indexed by transform id.
+// Setters only flag the id as dirty, Update rebuilds the world matrix of dirty ids in batches
+// and writes them into one contiguous array that can be handed straight to the GPU.
+//
+// Transforms can be parented, position/rotation/scale are then relative to the parent. Ids are
+// walked in depth order (parents before children) so a dirty parent marks its whole subtree in
+// the same linear pass, untouched subtrees are skipped.
+
+u32  Add(Entity* owner);
+// Children of a removed transform become roots and keep their last world matrix until they change
+void Remove(u32 id);
+
+// parent of u32_invalid_id detaches. The local transform is kept, so the child snaps to the new parent
+void    SetParent(u32 id, u32 parent);
+u32     Parent(u32 id);
+u32     FirstChild(u32 id);
+u32     NextSibling(u32 id);
+Entity* Owner(u32 id);
+
+// Local to the parent, same as world space for roots
+const vec3&       Position(u32 id);
+f32               Scale(u32 id);
+const quaternion& Rotation(u32 id);
+const mat4&       World(u32 id);
+
+// Safe to call from job threads as long as no two threads touch the same id
+void SetPosition(u32 id, const vec3& position);
+void SetScale(u32 id, f32 scale);
+void SetRotation(u32 id, const quaternion& rotation);
+
+// World matrices indexed by transform id, Count() entries long. Freed ids keep their last matrix
+const mat4* WorldTransforms();
+u32         Count();
+
+// Rebuilds every dirty world matrix (and everything below it) and calls the owner's OnUpdateWorldTransform
+void Update();
+
+// Ids whose world matrix changed during the last Update, in depth order
+const utl::vector<u32>& Updated();
+
+// Fixed timestep support. BeginTick snapshots the local transforms before a simulation tick. Interpolate
+// blends every id that changed during the last tick from that snapshot to its current state by alpha and
+// builds the matrices the renderer reads from, everything else keeps its world matrix. Ids added during
+// the tick don't blend, they appear where they are
+void BeginTick();
+void Interpolate(f32 alpha);
+
+// Valid after Interpolate, indexed by transform id like WorldTransforms()
+const mat4* RenderTransforms();
+const mat4& Render(u32 id);
+
+} // namespace retract::transform
@@ -25,14 +25,21 @@
 
 #include "Retract/Components/Entity.h"
 #include "Retract/Components/Sprite.h"
+#include "Retract/Components/Systems.h"
+#include "Retract/Components/Transform.h"
 #include "Window.h"
+#include "Jobs.h"
+#include "Loader.h"
 #include "Resources.h"
+#include "Retract/Graphics/GLState.h"
 #include "Retract/Graphics/Renderer.h"
-#include "Retract/Graphics/VertexArray.h"
+#include "Retract/Physics/Collision.h"
+#include "Retract/Util/FrameArena.h"
 
 #include <SDL2/SDL.h>
 
 #include <algorithm>
+#include <iterator>
 #include <ranges>
 #include <GL/glew.h>
 
@@ -42,14 +49,18 @@ namespace retract
 
 namespace
 {
-struct FrameInfo
-{
-    f32 ticks{};
-};
-
-FrameInfo          frame_info{};
+// Main thread time per frame that async loads may spend on their GL uploads
+constexpr f32 upload_budget_ms = 2.f;
 
+// Longest frame the accumulator takes in, anything past it (debugger breaks, loading hitches) is lost time
+constexpr u64 max_frame_ns = 250'000'000;
+// Ticks a single frame may run before the rest of the backlog is dropped. Without a cap a frame that is
+// slow because of the ticks builds up more ticks for the next one until the loop never catches up
+constexpr u32 max_ticks_per_frame = 8;
 
+constexpr const char* log_filename = "Retract.log";
+// Written when F9 is pressed
+constexpr const char* trace_filename = "RetractTrace.json";
 
 } // anonymous namespace
 
@@ -59,8 +70,12 @@ bool  Game::mConstructed = false;
 
 bool Game::InitializeInternal()
 {
+    logger::AddSink(CreateScope<logger::FileSink>(log_filename));
+    logger::Initialize();
     LOG_TRACE("ReactEngine initializing");
     random::Init();
+    jobs::Initialize();
+    loader::Initialize();
 
     if (!window::Init("Test", 1000, 800))
     {
@@ -96,24 +111,79 @@ i32 Game::Run()
         return -1;
     }
     m_running = true;
-    u32 st    = SDL_GetTicks();
+    profiler::SetThreadName("Main");
+
+    // Frame times are averaged over a second and shown in the title, setting it every frame isn't free
+    u64 stats_start = profiler::Now();
+    u32 stats_frames{ 0 };
+
+    // Starts a full tick in so there is a simulated state before the first frame is drawn
+    u64 previous_time = profiler::Now();
+    u64 accumulator   = m_tick_ns;
     while (m_running)
     {
-        const u32 start_time = SDL_GetTicks();
-        ProcessInputInternal();
-        Update();
-        Render();
-
-        const u32   frame_time = SDL_GetTicks() - start_time;
-        f32         fps        = (frame_time > 0) ? 1000.0f / (f32) frame_time : 0.0f;
-        std::string title      = std::format("RetractEngine - FPS: {:.5f}", fps);
-        window::SetTitle(title);
-
-        const u32 elapsed = SDL_GetTicks() - st;
-        if (elapsed >= 1000)
         {
-            LOG_TRACE("FPS: {:.5f}", fps);
-            st = SDL_GetTicks();
+            PROFILE_SCOPE("Frame");
+            memory::BeginFrame();
+
+            const u64 now      = profiler::Now();
+            const u64 frame_ns = math::Min(now - previous_time, max_frame_ns);
+            previous_time      = now;
+
+            accumulator += frame_ns;
+
+            ProcessInputInternal();
+
+            u32 ticks = 0;
+            while (accumulator >= m_tick_ns && ticks < max_ticks_per_frame)
+            {
+                Update();
+                accumulator -= m_tick_ns;
+                ++ticks;
+            }
+
+            // Still behind after the cap, the simulation runs slower than real time rather than spiral
+            if (accumulator >= m_tick_ns)
+            {
+                accumulator %= m_tick_ns;
+            }
+
+            // Once per frame rather than per tick, dead entities are skipped by updates until then
+            DestroyDeadEntities();
+
+            const f32 alpha = (f32) accumulator / (f32) m_tick_ns;
+            transform::Interpolate(alpha);
+            PreRender(alpha);
+            {
+                // Finish async loads that came in since last frame, before anything is drawn with them
+                PROFILE_SCOPE("Uploads");
+                loader::ProcessUploads(upload_budget_ms);
+            }
+            Render();
+        }
+
+        ++stats_frames;
+        const u64 elapsed_ns = profiler::Now() - stats_start;
+        if (elapsed_ns >= 1'000'000'000)
+        {
+            const f64 frame_ms = (f64) elapsed_ns / 1'000'000.0 / stats_frames;
+            memory::frame_string title{};
+            std::format_to(std::back_inserter(title), "RetractEngine - FPS: {:.1f} ({:.3f} ms)", 1000.0 / frame_ms, frame_ms);
+            window::SetTitle(title.c_str());
+            LOG_TRACE("FPS: {:.1f} ({:.3f} ms)", 1000.0 / frame_ms, frame_ms);
+
+            const graphics::CullStats& cull = graphics::GetCullStats();
+            LOG_TRACE("Meshes: {} tested, {} culled, {} drawn ({} at a lower LOD)", cull.tested, cull.culled, cull.drawn,
+                      cull.simplified);
+
+            const graphics::gl_state::Stats& gl = graphics::gl_state::LastFrame();
+            LOG_TRACE("GL state: {} calls issued, {} skipped", gl.issued, gl.skipped);
+#if RETRACT_COUNT_ALLOCATIONS
+            LOG_TRACE("Heap allocations last frame: {}", memory::LastFrameHeapAllocations());
+#endif
+
+            stats_start  = profiler::Now();
+            stats_frames = 0;
         }
     }
 
@@ -124,6 +194,7 @@ i32 Game::Run()
 void Game::ShutdownInternal() const
 {
     LOG_TRACE("ReactEngine shutting down");
+    loader::Shutdown();
 
     // Unload data
     while (!m_entities.empty())
@@ -133,32 +204,43 @@ void Game::ShutdownInternal() const
 
     graphics::Shutdown();
     window::Shutdown();
+    jobs::Shutdown();
+    logger::Shutdown();
 }
 void Game::AddEntity(Entity* entity)
 {
-    if (m_updating_entities)
-    {
-        m_pending_entities.emplace_back(entity);
-    } else
-    {
-        m_entities.emplace_back(entity);
-    }
+    utl::vector<Entity*>& list = m_updating_entities ? m_pending_entities : m_entities;
+    entity->mListIndex         = (u32) list.size();
+    entity->mPendingAdd        = m_updating_entities;
+    list.emplace_back(entity);
 }
 void Game::RemoveEntity(Entity* entity)
 {
-    auto it = std::ranges::find(m_pending_entities, entity);
-    if (it != m_pending_entities.end())
-    {
-        std::iter_swap(it, m_pending_entities.end() - 1);
-        m_pending_entities.pop_back();
-    }
+    utl::vector<Entity*>& list  = entity->mPendingAdd ? m_pending_entities : m_entities;
+    const u32             index = entity->mListIndex;
+    assert(index < list.size() && list[index] == entity);
+
+    list[index]             = list.back();
+    list[index]->mListIndex = index;
+    list.pop_back();
+    entity->mListIndex = u32_invalid_id;
+}
+
+void Game::QueueDestroy(const Entity* entity)
+{
+    m_dead_entities.emplace_back(entity->Handle());
+}
 
-    it = std::ranges::find(m_entities, entity);
-    if (it != m_entities.end())
+void Game::DestroyDeadEntities()
+{
+    PROFILE_FUNCTION();
+    // Handles skip anything deleted directly in the meantime. Deleting a parent kills its children,
+    // which land on the end of the queue and go in the same pass
+    for (u32 i = 0; i < m_dead_entities.size(); ++i)
     {
-        std::iter_swap(it, m_entities.end() - 1);
-        m_entities.pop_back();
+        delete Entity::Resolve(m_dead_entities[i]);
     }
+    m_dead_entities.clear();
 }
 
 
@@ -170,6 +252,12 @@ void Game::ProcessInputInternal()
         switch (event.type)
         {
         case SDL_QUIT: m_running = false; break;
+        case SDL_KEYDOWN:
+            if (event.key.keysym.scancode == SDL_SCANCODE_F9 && !event.key.repeat)
+            {
+                profiler::ExportChromeTrace(trace_filename);
+            }
+            break;
         }
     }
 
@@ -189,50 +277,54 @@ void Game::ProcessInputInternal()
     m_updating_entities = false;
 }
 
+void Game::SetTickRate(u32 ticks_per_second)
+{
+    assert(ticks_per_second > 0);
+    m_tick_ns    = 1'000'000'000 / ticks_per_second;
+    m_tick_delta = 1.f / (f32) ticks_per_second;
+}
+
 void Game::Update()
 {
-    f32 delta        = ((f32) SDL_GetTicks() - frame_info.ticks) / 1000.0f;
-    frame_info.ticks = (f32) SDL_GetTicks();
+    PROFILE_FUNCTION();
 
-    if (delta > 0.05f)
-        delta = 0.0f;
+    const f32 delta = m_tick_delta;
 
     m_updating_entities = true;
-    for (auto* ent : m_entities)
+
+    // Interpolation blends from the state the tick starts with
+    transform::BeginTick();
+    // Anything moved since last tick (input, spawns) is brought up to date before entities read it
+    transform::Update();
+    ecs::UpdateMovement(delta);
     {
-        ent->Update(delta);
+        PROFILE_SCOPE("Entity updates");
+        for (auto* ent : m_entities)
+        {
+            ent->Update(delta);
+        }
     }
+    // Also picks up entities spawned during the loop above
+    transform::Update();
+    // Colliders were moved by OnUpdateWorldTransform, pairs are ready for the next tick's entity updates
+    physics::Update();
 
     m_updating_entities = false;
 
     for (auto* pending_ent : m_pending_entities)
     {
-        pending_ent->CalculateWorldTransform();
+        pending_ent->mListIndex  = (u32) m_entities.size();
+        pending_ent->mPendingAdd = false;
         m_entities.emplace_back(pending_ent);
     }
     m_pending_entities.clear();
-
-    utl::vector<Entity*> dead_entities{};
-    for (auto* ent : m_entities)
-    {
-        if (ent->CurrentState() == Entity::State::dead)
-        {
-            dead_entities.emplace_back(ent);
-        }
-    }
-
-    // stuff might need to happen with dead entities?
-
-    for (const auto* ent : dead_entities)
-    {
-        delete ent;
-        ent = nullptr;
-    }
 }
 
 void Game::Render() const
 {
     graphics::Render();
+
+    PROFILE_SCOPE("Swap buffers");
     window::SwapBuffers();
 }
 
@@ -24,11 +24,10 @@
 #pragma once
 
 #include "Retract/Common.h"
-
+#include "Retract/Components/Entity.h"
 
 namespace retract
 {
-class Entity;
 class Sprite;
 
 class Game
@@ -41,9 +40,18 @@ public:
 
     virtual void Init() = 0;
     virtual void ProcessInput(const u8* key_state) {}
+    // Once per rendered frame, after transforms were interpolated. alpha is how far the frame is past the last tick
+    virtual void PreRender(f32 alpha) {}
+
+    // The simulation always advances in steps of 1 / ticks_per_second, independent of the frame rate
+    void          SetTickRate(u32 ticks_per_second);
+    constexpr f32 TickDelta() const { return m_tick_delta; }
 
+    // O(1), entities know their slot in the list
     void AddEntity(Entity* entity);
     void RemoveEntity(Entity* entity);
+    // Deleted with the rest of the dead once the frame's ticks are done. Safe to call again or after a direct delete
+    void QueueDestroy(const Entity* entity);
 
     template<typename T>
     static T* As()
@@ -58,13 +66,17 @@ private:
     void ShutdownInternal() const;
     void ProcessInputInternal();
     void Update();
+    void DestroyDeadEntities();
     void Render() const;
 
     bool m_running{ false };
+    u64  m_tick_ns{ 1'000'000'000 / 60 };
+    f32  m_tick_delta{ 1.f / 60.f };
 
-    utl::vector<Entity*> m_entities{};
-    utl::vector<Entity*> m_pending_entities{};
-    bool                 m_updating_entities{ false };
+    utl::vector<Entity*>      m_entities{};
+    utl::vector<Entity*>      m_pending_entities{};
+    utl::vector<EntityHandle> m_dead_entities{};
+    bool                      m_updating_entities{ false };
 
     static Game* mInstance;
     static bool  mConstructed;
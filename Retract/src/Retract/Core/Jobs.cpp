@@ -0,0 +1,282 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Jobs.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "Jobs.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace retract::jobs
+{
+
+namespace
+{
+struct Job
+{
+    job_func func{};
+    Counter* counter{};
+};
+
+// Owner pushes and pops at the back, thieves take from the front so they grab the oldest (usually biggest) work
+class WorkQueue
+{
+public:
+    void Push(Job&& job)
+    {
+        std::lock_guard lock{ mMutex };
+        mJobs.emplace_back(std::move(job));
+    }
+
+    bool Pop(Job& out)
+    {
+        std::lock_guard lock{ mMutex };
+        if (mJobs.empty())
+            return false;
+
+        out = std::move(mJobs.back());
+        mJobs.pop_back();
+        return true;
+    }
+
+    bool Steal(Job& out)
+    {
+        std::lock_guard lock{ mMutex };
+        if (mJobs.empty())
+            return false;
+
+        out = std::move(mJobs.front());
+        mJobs.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex      mMutex{};
+    std::deque<Job> mJobs{};
+};
+
+utl::vector<scope<WorkQueue>> queues{};
+utl::vector<std::thread>      threads{};
+std::atomic<bool>             running{ false };
+std::atomic<u32>              pending_jobs{ 0 };
+std::mutex                    sleep_mutex{};
+std::condition_variable       wake_condition{};
+bool                          single_threaded{ false };
+
+// Threads the job system didn't create submit through the main thread's queue
+thread_local u32 worker_index{ 0 };
+
+void Execute(Job& job)
+{
+    job.func();
+    if (job.counter)
+    {
+        job.counter->value.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+bool RunOne(u32 index)
+{
+    Job job{};
+    bool found = queues[index]->Pop(job);
+
+    const u32 count = (u32) queues.size();
+    for (u32 i = 1; !found && i < count; ++i)
+    {
+        found = queues[(index + i) % count]->Steal(job);
+    }
+
+    if (!found)
+        return false;
+
+    pending_jobs.fetch_sub(1, std::memory_order_relaxed);
+    Execute(job);
+    return true;
+}
+
+void WorkerLoop(u32 index)
+{
+    worker_index = index;
+    profiler::SetThreadName("Job worker");
+    while (running)
+    {
+        if (RunOne(index))
+            continue;
+
+        std::unique_lock lock{ sleep_mutex };
+        wake_condition.wait(lock, [] { return pending_jobs > 0 || !running; });
+    }
+}
+
+} // anonymous namespace
+
+bool Initialize(u32 worker_count)
+{
+    if (running)
+    {
+        LOG_WARN("Job system is already initialized");
+        return true;
+    }
+
+    if (worker_count == 0)
+    {
+        const u32 hardware = std::thread::hardware_concurrency();
+        worker_count       = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    LOG_INFO("Starting job system with {} worker threads", worker_count);
+
+    queues.clear();
+    for (u32 i = 0; i <= worker_count; ++i)
+    {
+        queues.emplace_back(CreateScope<WorkQueue>());
+    }
+
+    running = true;
+    for (u32 i = 1; i <= worker_count; ++i)
+    {
+        threads.emplace_back(WorkerLoop, i);
+    }
+
+    return true;
+}
+
+void Shutdown()
+{
+    {
+        std::lock_guard lock{ sleep_mutex };
+        running = false;
+    }
+    wake_condition.notify_all();
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    threads.clear();
+    queues.clear();
+}
+
+void SetSingleThreaded(bool enable)
+{
+    single_threaded = enable;
+}
+
+bool IsSingleThreaded()
+{
+    return single_threaded || threads.empty();
+}
+
+u32 WorkerCount()
+{
+    return IsSingleThreaded() ? 1 : (u32) threads.size() + 1;
+}
+
+void Run(job_func job, Counter* counter)
+{
+    if (counter)
+    {
+        counter->value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Job j{ std::move(job), counter };
+    if (IsSingleThreaded())
+    {
+        Execute(j);
+        return;
+    }
+
+    // Counted before the push, a thief may pop and decrement the job before this thread gets past Push
+    {
+        std::lock_guard lock{ sleep_mutex };
+        ++pending_jobs;
+    }
+    queues[worker_index]->Push(std::move(j));
+    wake_condition.notify_one();
+}
+
+void ParallelFor(u32 count, u32 batch_size, const range_func& func)
+{
+    if (count == 0)
+        return;
+
+    batch_size = math::Max(batch_size, 1u);
+    if (IsSingleThreaded() || count <= batch_size)
+    {
+        func(0, count);
+        return;
+    }
+
+    Counter counter{};
+    for (u32 begin = batch_size; begin < count; begin += batch_size)
+    {
+        const u32 end = math::Min(begin + batch_size, count);
+        Run([&func, begin, end] { func(begin, end); }, &counter);
+    }
+
+    func(0, batch_size);
+    Wait(counter);
+}
+
+void ParallelForBatches(u32 count, u32 batch_size, const batch_func& func)
+{
+    if (count == 0)
+        return;
+
+    batch_size            = math::Max(batch_size, 1u);
+    const u32 batch_count = BatchCount(count, batch_size);
+    if (IsSingleThreaded() || batch_count == 1)
+    {
+        for (u32 batch = 0; batch < batch_count; ++batch)
+        {
+            func(batch, batch * batch_size, math::Min(batch * batch_size + batch_size, count));
+        }
+        return;
+    }
+
+    Counter counter{};
+    for (u32 batch = 1; batch < batch_count; ++batch)
+    {
+        const u32 begin = batch * batch_size;
+        const u32 end   = math::Min(begin + batch_size, count);
+        Run([&func, batch, begin, end] { func(batch, begin, end); }, &counter);
+    }
+
+    func(0, 0, batch_size);
+    Wait(counter);
+}
+
+void Wait(Counter& counter)
+{
+    while (counter.value.load(std::memory_order_acquire) > 0)
+    {
+        if (queues.empty() || !RunOne(worker_index))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+} // namespace retract::jobs
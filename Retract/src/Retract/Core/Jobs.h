@@ -0,0 +1,73 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Jobs.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Retract/Common.h"
+
+#include <atomic>
+#include <functional>
+
+namespace retract::jobs
+{
+
+using job_func   = std::function<void()>;
+using range_func = std::function<void(u32 begin, u32 end)>;
+using batch_func = std::function<void(u32 batch, u32 begin, u32 end)>;
+
+// Jobs decrement their counter when finished, Wait blocks until it reaches zero
+struct Counter
+{
+    std::atomic<u32> value{ 0 };
+};
+
+// worker_count of 0 picks hardware_concurrency - 1. The calling thread is always worker 0
+bool Initialize(u32 worker_count = 0);
+void Shutdown();
+
+// Deterministic mode for debugging: every job runs inline on the submitting thread, in submission order
+void SetSingleThreaded(bool single_threaded);
+bool IsSingleThreaded();
+
+// Number of threads executing jobs, including the main thread
+u32 WorkerCount();
+
+void Run(job_func job, Counter* counter = nullptr);
+
+// Splits [0, count) into batches of batch_size and spreads them across the workers.
+// Blocks until every batch is done, the calling thread works on batches while it waits
+void ParallelFor(u32 count, u32 batch_size, const range_func& func);
+
+constexpr u32 BatchCount(u32 count, u32 batch_size)
+{
+    return (count + batch_size - 1) / batch_size;
+}
+
+// ParallelFor for callers that keep an output per batch. Batch b is always [b * batch_size, (b + 1) * batch_size)
+// clamped to count, also when everything runs inline, so batch indexes [0, BatchCount(count, batch_size))
+void ParallelForBatches(u32 count, u32 batch_size, const batch_func& func);
+
+// Executes pending jobs on the calling thread until the counter hits zero
+void Wait(Counter& counter);
+
+} // namespace retract::jobs
@@ -0,0 +1,167 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Loader.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "Loader.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace retract::loader
+{
+
+namespace
+{
+std::deque<load_func>   load_queue{};
+std::mutex              load_mutex{};
+std::condition_variable load_condition{};
+
+std::deque<upload_func> upload_queue{};
+std::mutex              upload_mutex{};
+
+utl::vector<std::thread> threads{};
+bool                     running{ false };
+std::atomic<u32>         pending{ 0 };
+
+void PushUpload(upload_func&& upload)
+{
+    if (!upload)
+    {
+        pending.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+
+    std::lock_guard lock{ upload_mutex };
+    upload_queue.emplace_back(std::move(upload));
+}
+
+void LoaderLoop()
+{
+    profiler::SetThreadName("Loader");
+    while (true)
+    {
+        load_func load{};
+        {
+            std::unique_lock lock{ load_mutex };
+            load_condition.wait(lock, [] { return !load_queue.empty() || !running; });
+            if (!running)
+                return;
+
+            load = std::move(load_queue.front());
+            load_queue.pop_front();
+        }
+
+        PushUpload(load());
+    }
+}
+} // anonymous namespace
+
+bool Initialize(u32 thread_count)
+{
+    if (!threads.empty())
+    {
+        LOG_WARN("Loader is already initialized");
+        return true;
+    }
+
+    LOG_INFO("Starting {} loader threads", thread_count);
+    running = true;
+    for (u32 i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back(LoaderLoop);
+    }
+
+    return true;
+}
+
+void Shutdown()
+{
+    {
+        std::lock_guard lock{ load_mutex };
+        running = false;
+    }
+    load_condition.notify_all();
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    threads.clear();
+
+    // Whatever didn't make it is dropped, the captured data cleans itself up
+    load_queue.clear();
+    upload_queue.clear();
+    pending = 0;
+}
+
+void Enqueue(load_func load)
+{
+    pending.fetch_add(1, std::memory_order_relaxed);
+    if (threads.empty())
+    {
+        PushUpload(load());
+        return;
+    }
+
+    {
+        std::lock_guard lock{ load_mutex };
+        load_queue.emplace_back(std::move(load));
+    }
+    load_condition.notify_one();
+}
+
+void ProcessUploads(f32 budget_ms)
+{
+    using clock      = std::chrono::steady_clock;
+    const auto start = clock::now();
+
+    while (true)
+    {
+        upload_func upload{};
+        {
+            std::lock_guard lock{ upload_mutex };
+            if (upload_queue.empty())
+                return;
+
+            upload = std::move(upload_queue.front());
+            upload_queue.pop_front();
+        }
+
+        upload();
+        pending.fetch_sub(1, std::memory_order_relaxed);
+
+        const std::chrono::duration<f32, std::milli> elapsed = clock::now() - start;
+        if (elapsed.count() >= budget_ms)
+            return;
+    }
+}
+
+u32 Pending()
+{
+    return pending.load(std::memory_order_relaxed);
+}
+
+} // namespace retract::loader
@@ -0,0 +1,52 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Loader.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Retract/Common.h"
+
+#include <functional>
+
+namespace retract::loader
+{
+
+// Finishing step of a load, runs on the render thread since it usually talks to GL
+using upload_func = std::function<void()>;
+// File reading and decoding, runs on a loader thread and returns the step to finish on the render thread
+using load_func = std::function<upload_func()>;
+
+// Loader threads only do blocking I/O and decoding so they are kept apart from the job workers
+bool Initialize(u32 thread_count = 2);
+void Shutdown();
+
+// Without loader threads (not initialized) the load step runs inline, the upload is still queued
+void Enqueue(load_func load);
+
+// Runs queued uploads until budget_ms has been spent. At least one upload runs per call so a
+// single large asset can't starve forever
+void ProcessUploads(f32 budget_ms);
+
+// Loads that have been enqueued but not uploaded yet
+u32 Pending();
+
+} // namespace retract::loader
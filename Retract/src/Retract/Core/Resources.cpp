@@ -22,7 +22,12 @@
 //  ------------------------------------------------------------------------------
 #include "Resources.h"
 
+#include "Loader.h"
+#include "Retract/Graphics/MeshFormat.h"
+#include "Retract/Graphics/MeshOptimizer.h"
+#include "Retract/Util/MappedFile.h"
 
+#include <filesystem>
 #include <ranges>
 
 namespace retract::core
@@ -33,6 +38,28 @@ namespace
 std::unordered_map<std::string, Texture*> textures{};
 std::unordered_map<std::string, Shader*>  shaders{};
 std::unordered_map<std::string, Mesh*>    meshes{};
+
+// A converted .rmesh next to the source is used instead of parsing the json
+std::string MeshPath(const std::string& filename)
+{
+    const std::string binary = mesh_format::BinaryPath(filename);
+    return binary != filename && std::filesystem::exists(binary) ? binary : filename;
+}
+
+// Touches every page of the mapping on the loader thread so the upload doesn't take the page faults
+void Prefetch(const MappedFile& file)
+{
+    PROFILE_SCOPE("Prefetch mesh");
+    constexpr u64 page_size = 4096;
+
+    const volatile u8* bytes = (const volatile u8*) file.Data();
+    u8                 sum   = 0;
+    for (u64 i = 0; i < file.Size(); i += page_size)
+    {
+        sum += bytes[i];
+    }
+    (void) sum;
+}
 } // anonymous namespace
 
 Texture* GetTexture(const std::string& filename)
@@ -51,6 +78,31 @@ Texture* GetTexture(const std::string& filename)
     return nullptr;
 }
 
+Texture* GetTextureAsync(const std::string& filename)
+{
+    if (const auto it = textures.find(filename); it != textures.end())
+    {
+        return it->second;
+    }
+
+    auto* tex = DBG_NEW Texture{};
+    tex->SetPlaceholder(GetTexture(default_texture));
+    textures.emplace(filename, tex);
+
+    loader::Enqueue([tex, filename]() -> loader::upload_func {
+        auto image = std::make_shared<Texture::Image>();
+        if (!Texture::Decode(filename, *image))
+        {
+            // Keeps drawing as the placeholder
+            return {};
+        }
+
+        return [tex, image] { tex->Upload(*image); };
+    });
+
+    return tex;
+}
+
 void UnloadTextures()
 {
     for (const auto& tex : textures | std::views::values)
@@ -94,7 +146,7 @@ Mesh* GetMesh(const std::string& filename)
     } else
     {
         m = DBG_NEW Mesh{};
-        if (m->Load(filename))
+        if (m->Load(MeshPath(filename)))
         {
             meshes.emplace(filename, m);
         } else
@@ -106,6 +158,48 @@ Mesh* GetMesh(const std::string& filename)
     return m;
 }
 
+Mesh* GetMeshAsync(const std::string& filename)
+{
+    if (const auto it = meshes.find(filename); it != meshes.end())
+    {
+        return it->second;
+    }
+
+    auto* m = DBG_NEW Mesh{};
+    meshes.emplace(filename, m);
+
+    loader::Enqueue([m, path = MeshPath(filename)]() -> loader::upload_func {
+        LOG_INFO("Loading mesh {}", path);
+        if (path.ends_with(".rmesh"))
+        {
+            auto file = std::make_shared<MappedFile>(path);
+            if (!file->IsOpen() || !mesh_format::ValidateBinary(file->Data(), file->Size()))
+            {
+                LOG_WARN("Mesh '{}' is not a valid binary mesh", path);
+                return {};
+            }
+
+            Prefetch(*file);
+            return [m, file] { m->Create(*file, true); };
+        }
+
+        auto source = std::make_shared<mesh_format::MeshSource>();
+        if (!mesh_format::ReadGpMesh(path, *source))
+        {
+            return {};
+        }
+
+        const mesh_optimizer::OptimizeStats stats = mesh_optimizer::Optimize(*source);
+        LOG_INFO("Mesh '{}' optimized: {} -> {} vertices, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, {} LODs", path,
+                 stats.vertices_before, stats.vertices_after, stats.before.acmr, stats.after.acmr, stats.before.atvr,
+                 stats.after.atvr, stats.lod_count);
+
+        return [m, source] { m->Create(*source, true); };
+    });
+
+    return m;
+}
+
 void UnloadMeshes()
 {
     for (const auto& m : meshes | std::views::values)
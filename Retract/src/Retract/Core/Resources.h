@@ -31,9 +31,18 @@
 namespace retract::core
 {
 
+// Served in place of textures that failed to load or are still loading
+constexpr const char* default_texture = "./Content/default.png";
+
 Texture* GetTexture(const std::string& filename);
 void UnloadTextures();
 
+// Hand back the resource right away and load it through the loader threads. A texture draws as
+// default_texture and a mesh is skipped by the renderer until its upload has run. The returned
+// pointer stays the same once the real data is in, so it can be stored immediately
+Texture* GetTextureAsync(const std::string& filename);
+Mesh*    GetMeshAsync(const std::string& filename);
+
 Shader* LoadShader(const std::string& name, const std::string& vertex, const std::string& frag);
 Shader* GetShader(const std::string& name);
 void UnloadShaders();
@@ -118,9 +118,9 @@ void SwapBuffers()
     SDL_GL_SwapWindow(window_handle);
 }
 
-void SetTitle(const std::string& title)
+void SetTitle(const char* title)
 {
-    SDL_SetWindowTitle(window_handle, title.c_str());
+    SDL_SetWindowTitle(window_handle, title);
 }
 
 SDL_Window* Handle()
@@ -0,0 +1,127 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Frustum.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "Frustum.h"
+
+#include <bit>
+
+namespace retract::graphics
+{
+
+namespace
+{
+// With row vectors clip = v * M, so each clip coordinate is v dotted with a column of M
+vec4 Column(const mat4& m, u32 c)
+{
+    return { m.mat[0][c], m.mat[1][c], m.mat[2][c], m.mat[3][c] };
+}
+
+vec4 NormalizePlane(const vec4& p)
+{
+    const f32 inv_length = 1.f / math::Sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+    return { p.x * inv_length, p.y * inv_length, p.z * inv_length, p.w * inv_length };
+}
+} // anonymous namespace
+
+// -w <= x, y, z <= w, each side of every inequality is one plane (Gribb/Hartmann)
+Frustum Frustum::FromMatrix(const mat4& view_proj)
+{
+    const vec4 x = Column(view_proj, 0);
+    const vec4 y = Column(view_proj, 1);
+    const vec4 z = Column(view_proj, 2);
+    const vec4 w = Column(view_proj, 3);
+
+    Frustum frustum{};
+    frustum.planes[left_plane]   = NormalizePlane(w + x);
+    frustum.planes[right_plane]  = NormalizePlane(w - x);
+    frustum.planes[bottom_plane] = NormalizePlane(w + y);
+    frustum.planes[top_plane]    = NormalizePlane(w - y);
+    frustum.planes[near_plane]   = NormalizePlane(w + z);
+    frustum.planes[far_plane]    = NormalizePlane(w - z);
+    return frustum;
+}
+
+bool Frustum::Intersects(const vec3& center, f32 radius) const
+{
+    for (const vec4& p : planes)
+    {
+        if (p.x * center.x + p.y * center.y + p.z * center.z + p.w < -radius)
+            return false;
+    }
+
+    return true;
+}
+
+u32 Frustum::CullSpheres(const f32* x, const f32* y, const f32* z, const f32* radius, u32 count, u8* visible) const
+{
+    u32 visible_count = 0;
+    u32 i             = 0;
+#if RETRACT_SIMD_SSE
+    __m128 px[plane_count];
+    __m128 py[plane_count];
+    __m128 pz[plane_count];
+    __m128 pw[plane_count];
+    for (u32 p = 0; p < plane_count; ++p)
+    {
+        px[p] = _mm_set1_ps(planes[p].x);
+        py[p] = _mm_set1_ps(planes[p].y);
+        pz[p] = _mm_set1_ps(planes[p].z);
+        pw[p] = _mm_set1_ps(planes[p].w);
+    }
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 cx         = _mm_loadu_ps(x + i);
+        const __m128 cy         = _mm_loadu_ps(y + i);
+        const __m128 cz         = _mm_loadu_ps(z + i);
+        const __m128 neg_radius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + i));
+
+        // A lane is out as soon as it is fully behind any one plane
+        __m128 outside = _mm_setzero_ps();
+        for (u32 p = 0; p < plane_count; ++p)
+        {
+            __m128 distance = _mm_add_ps(_mm_mul_ps(px[p], cx), pw[p]);
+            distance        = _mm_add_ps(_mm_mul_ps(py[p], cy), distance);
+            distance        = _mm_add_ps(_mm_mul_ps(pz[p], cz), distance);
+            outside         = _mm_or_ps(outside, _mm_cmplt_ps(distance, neg_radius));
+        }
+
+        const i32 mask = ~_mm_movemask_ps(outside) & 0xF;
+        for (u32 lane = 0; lane < 4; ++lane)
+        {
+            visible[i + lane] = (u8) ((mask >> lane) & 1);
+        }
+        visible_count += (u32) std::popcount((u32) mask);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        visible[i]     = Intersects({ x[i], y[i], z[i] }, radius[i]) ? 1 : 0;
+        visible_count += visible[i];
+    }
+
+    return visible_count;
+}
+
+} // namespace retract::graphics
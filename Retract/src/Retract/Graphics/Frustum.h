@@ -0,0 +1,59 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Frustum.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Common.h"
+
+namespace retract::graphics
+{
+
+// Six planes facing inwards, normalized so plane . (p, 1) is the signed distance of p
+struct Frustum
+{
+    enum Plane : u32
+    {
+        left_plane,
+        right_plane,
+        bottom_plane,
+        top_plane,
+        near_plane,
+        far_plane,
+
+        plane_count
+    };
+
+    vec4 planes[plane_count]{};
+
+    // Clip volume of a row vector view * projection matrix with GL's -w..w depth range
+    static Frustum FromMatrix(const mat4& view_proj);
+
+    [[nodiscard]] bool Intersects(const vec3& center, f32 radius) const;
+
+    // Batch test over spheres stored as separate x, y, z and radius arrays, four at a time with SSE.
+    // visible[i] is 1 when sphere i is at least partly inside. Returns the number of visible spheres
+    u32 CullSpheres(const f32* x, const f32* y, const f32* z, const f32* radius, u32 count, u8* visible) const;
+};
+
+} // namespace retract::graphics
@@ -0,0 +1,205 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: GLState.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "GLState.h"
+
+#include <GL/glew.h>
+
+namespace retract::graphics::gl_state
+{
+
+namespace
+{
+// u32_invalid_id marks a value that isn't known, 0 is a valid binding
+constexpr u32 unknown = u32_invalid_id;
+
+struct BlendFunc
+{
+    u32 src_rgb{ unknown };
+    u32 dst_rgb{ unknown };
+    u32 src_alpha{ unknown };
+    u32 dst_alpha{ unknown };
+
+    bool operator==(const BlendFunc&) const = default;
+};
+
+struct BlendEquation
+{
+    u32 rgb{ unknown };
+    u32 alpha{ unknown };
+
+    bool operator==(const BlendEquation&) const = default;
+};
+
+u32           program{ unknown };
+u32           vertex_array{ unknown };
+u32           active_unit{ unknown };
+u32           textures[max_texture_units]{};
+u32           depth_test{ unknown };
+u32           blend{ unknown };
+BlendFunc     blend_func{};
+BlendEquation blend_equation{};
+
+Stats current{};
+Stats last_frame{};
+
+// Stores value in state and returns true when the driver has to hear about it
+template<typename T>
+bool Change(T& state, const T& value)
+{
+    if (state == value)
+    {
+        ++current.skipped;
+        return false;
+    }
+
+    state = value;
+    ++current.issued;
+    return true;
+}
+
+void SetCapability(u32& state, GLenum capability, bool enabled)
+{
+    if (Change(state, (u32) enabled))
+    {
+        enabled ? glEnable(capability) : glDisable(capability);
+    }
+}
+
+} // anonymous namespace
+
+void Invalidate()
+{
+    program        = unknown;
+    vertex_array   = unknown;
+    active_unit    = unknown;
+    depth_test     = unknown;
+    blend          = unknown;
+    blend_func     = {};
+    blend_equation = {};
+    for (u32& texture : textures)
+    {
+        texture = unknown;
+    }
+}
+
+void BeginFrame()
+{
+    last_frame = current;
+    current    = {};
+}
+
+const Stats& LastFrame()
+{
+    return last_frame;
+}
+
+void UseProgram(u32 id)
+{
+    if (Change(program, id))
+    {
+        glUseProgram(id);
+    }
+}
+
+void BindVertexArray(u32 vao)
+{
+    if (Change(vertex_array, vao))
+    {
+        glBindVertexArray(vao);
+    }
+}
+
+void BindTexture(u32 unit, u32 texture)
+{
+    assert(unit < max_texture_units);
+    if (textures[unit] == texture)
+    {
+        ++current.skipped;
+        return;
+    }
+
+    if (Change(active_unit, unit))
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+    }
+
+    textures[unit] = texture;
+    ++current.issued;
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void SetDepthTest(bool enabled)
+{
+    SetCapability(depth_test, GL_DEPTH_TEST, enabled);
+}
+
+void SetBlend(bool enabled)
+{
+    SetCapability(blend, GL_BLEND, enabled);
+}
+
+void SetBlendEquation(u32 rgb, u32 alpha)
+{
+    if (Change(blend_equation, BlendEquation{ rgb, alpha }))
+    {
+        glBlendEquationSeparate(rgb, alpha);
+    }
+}
+
+void SetBlendFunc(u32 src_rgb, u32 dst_rgb, u32 src_alpha, u32 dst_alpha)
+{
+    if (Change(blend_func, BlendFunc{ src_rgb, dst_rgb, src_alpha, dst_alpha }))
+    {
+        glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha);
+    }
+}
+
+void ForgetProgram(u32 id)
+{
+    if (program == id)
+    {
+        program = unknown;
+    }
+}
+
+void ForgetVertexArray(u32 vao)
+{
+    if (vertex_array == vao)
+    {
+        vertex_array = unknown;
+    }
+}
+
+void ForgetTexture(u32 texture)
+{
+    for (u32& bound : textures)
+    {
+        if (bound == texture)
+        {
+            bound = unknown;
+        }
+    }
+}
+
+} // namespace retract::graphics::gl_state
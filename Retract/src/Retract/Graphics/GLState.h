@@ -0,0 +1,67 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: GLState.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Common.h"
+
+// Thin cache in front of the GL binds the renderer issues every frame. Each call compares against the last
+// value set through here and only reaches the driver when it differs. Anything binding behind its back has
+// to go through here as well (or call Invalidate), otherwise a later bind can be wrongly skipped.
+// Main thread only, like the rest of GL
+namespace retract::graphics::gl_state
+{
+
+constexpr u32 max_texture_units = 16;
+
+// Driver calls made and elided through the cache, per frame
+struct Stats
+{
+    u32 issued{};
+    u32 skipped{};
+};
+
+// Forgets everything, the next call of each kind always reaches the driver. Called once the context exists
+void Invalidate();
+
+// Publishes the current counts as LastFrame and starts counting again
+void BeginFrame();
+const Stats& LastFrame();
+
+void UseProgram(u32 program);
+void BindVertexArray(u32 vao);
+// GL_TEXTURE_2D on the given unit, switching the active unit only when needed
+void BindTexture(u32 unit, u32 texture);
+
+void SetDepthTest(bool enabled);
+void SetBlend(bool enabled);
+void SetBlendEquation(u32 rgb, u32 alpha);
+void SetBlendFunc(u32 src_rgb, u32 dst_rgb, u32 src_alpha, u32 dst_alpha);
+
+// GL hands the names of deleted objects out again, so these drop a name before its object goes away
+void ForgetProgram(u32 program);
+void ForgetVertexArray(u32 vao);
+void ForgetTexture(u32 texture);
+
+} // namespace retract::graphics::gl_state
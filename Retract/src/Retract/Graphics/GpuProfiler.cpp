@@ -0,0 +1,120 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: GpuProfiler.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "GpuProfiler.h"
+
+#include <GL/glew.h>
+
+namespace retract::graphics::gpu_profiler
+{
+
+namespace
+{
+// Frames a query set waits before being read back, enough for the driver to have finished them
+constexpr u32 frame_latency       = 4;
+constexpr u32 max_zones_per_frame = 16;
+
+struct QueryFrame
+{
+    GLuint      queries[max_zones_per_frame]{};
+    const char* names[max_zones_per_frame]{};
+    u64         cpu_start[max_zones_per_frame]{};
+    u32         count{};
+};
+
+QueryFrame       frames[frame_latency]{};
+u32              frame_index{};
+profiler::Track* track{};
+bool             zone_open{ false };
+} // anonymous namespace
+
+bool Initialize()
+{
+    for (QueryFrame& frame : frames)
+    {
+        glGenQueries(max_zones_per_frame, frame.queries);
+    }
+
+    if (!track)
+    {
+        track = profiler::CreateTrack("GPU");
+    }
+
+    return true;
+}
+
+void Shutdown()
+{
+    for (QueryFrame& frame : frames)
+    {
+        glDeleteQueries(max_zones_per_frame, frame.queries);
+        frame.count = 0;
+    }
+}
+
+void BeginFrame()
+{
+    frame_index       = (frame_index + 1) % frame_latency;
+    QueryFrame& frame = frames[frame_index];
+
+    for (u32 i = 0; i < frame.count; ++i)
+    {
+        GLint available{};
+        glGetQueryObjectiv(frame.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            continue;
+
+        GLuint64 elapsed_ns{};
+        glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &elapsed_ns);
+        profiler::Record(track, frame.names[i], frame.cpu_start[i], frame.cpu_start[i] + elapsed_ns);
+    }
+
+    frame.count = 0;
+}
+
+GpuZone::GpuZone(const char* name)
+{
+    QueryFrame& frame = frames[frame_index];
+    if (!track || zone_open || frame.count == max_zones_per_frame)
+        return;
+
+    const u32 index        = frame.count++;
+    frame.names[index]     = name;
+    frame.cpu_start[index] = profiler::Now();
+    glBeginQuery(GL_TIME_ELAPSED, frame.queries[index]);
+
+    zone_open = true;
+    mActive   = true;
+}
+
+GpuZone::~GpuZone()
+{
+    if (!mActive)
+        return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    zone_open = false;
+}
+
+} // namespace retract::graphics::gpu_profiler
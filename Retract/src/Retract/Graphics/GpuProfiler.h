@@ -0,0 +1,61 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: GpuProfiler.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Common.h"
+#include "Retract/Util/Profiler.h"
+
+namespace retract::graphics::gpu_profiler
+{
+
+bool Initialize();
+void Shutdown();
+
+// Reads back the queries issued a few frames ago onto the "GPU" profiler track, then starts a new frame.
+// Results that still aren't available are dropped rather than stalling on them
+void BeginFrame();
+
+// Times the GL commands issued during its lifetime with a GL_TIME_ELAPSED query. Those queries can't
+// nest, so a zone opened inside another is ignored. The zone is placed at the CPU time it was issued
+class GpuZone
+{
+public:
+    explicit GpuZone(const char* name);
+    ~GpuZone();
+
+    GpuZone(const GpuZone&)            = delete;
+    GpuZone& operator=(const GpuZone&) = delete;
+
+private:
+    bool mActive{ false };
+};
+
+} // namespace retract::graphics::gpu_profiler
+
+#if RETRACT_PROFILE
+    #define PROFILE_GPU_SCOPE(name) const retract::graphics::gpu_profiler::GpuZone RETRACT_CONCAT(gpu_zone_, __LINE__){ name }
+#else
+    #define PROFILE_GPU_SCOPE(name)
+#endif
@@ -21,133 +21,186 @@
 //
 //  ------------------------------------------------------------------------------
 #include "Mesh.h"
+#include "MeshFormat.h"
+#include "MeshOptimizer.h"
 #include "Renderer.h"
 #include "Retract/Core/Resources.h"
+#include "Retract/Util/MappedFile.h"
 
-
-#include <fstream>
-#include <sstream>
-#include <rapidjson/document.h>
+#include <cstring>
 
 namespace retract
 {
 
 bool Mesh::Load(const std::string& filename)
 {
+    PROFILE_SCOPE("Load mesh");
     LOG_INFO("Loading mesh {}", filename);
-    std::ifstream file{ filename };
-    if (!file.is_open())
+    if (filename.ends_with(".rmesh"))
     {
-        LOG_WARN("Mesh file not found: {}", filename);
-        return false;
+        const MappedFile file{ filename };
+        if (!file.IsOpen())
+        {
+            LOG_WARN("Mesh file not found: {}", filename);
+            return false;
+        }
+
+        if (!Create(file, false))
+        {
+            LOG_WARN("Mesh '{}' is not a valid binary mesh", filename);
+            return false;
+        }
+    } else
+    {
+        mesh_format::MeshSource source{};
+        if (!mesh_format::ReadGpMesh(filename, source))
+        {
+            return false;
+        }
+
+        // Converted meshes were optimized by MeshConverter already
+        const mesh_optimizer::OptimizeStats stats = mesh_optimizer::Optimize(source);
+        LOG_INFO("Mesh '{}' optimized: {} -> {} vertices, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, {} LODs", filename,
+                 stats.vertices_before, stats.vertices_after, stats.before.acmr, stats.after.acmr, stats.before.atvr,
+                 stats.after.atvr, stats.lod_count);
+        Create(source, false);
     }
 
-    std::stringstream filestream{};
-    filestream << file.rdbuf();
-    std::string             contents = filestream.str();
-    rapidjson::StringStream jsonStr{ contents.c_str() };
-    rapidjson::Document     doc{};
-    doc.ParseStream(jsonStr);
+    LOG_INFO("Mesh '{}' loaded", filename);
+    return true;
+}
 
-    if (!doc.IsObject())
+void Mesh::Create(const mesh_format::MeshSource& source, bool async_textures)
+{
+    PROFILE_SCOPE("Upload mesh");
+    mShaderName    = source.shader_name;
+    mSpecularPower = source.specular_power;
+    mRadius        = source.radius;
+    mBoundsMin     = source.bounds_min;
+    mBoundsMax     = source.bounds_max;
+
+    for (const auto& texture : source.textures)
     {
-        LOG_WARN("Mesh '{}' is not a valid json object", filename);
-        return false;
+        AddTexture(texture, async_textures);
     }
 
-    i32 ver = doc["version"].GetInt();
-    if (ver != 1)
+    ComputeBoundingSphere();
+
+    const u32                                 num_verts  = (u32) source.vertices.size() / mesh_format::floats_per_vertex;
+    const graphics::mesh_buffer::VertexFormat format     = mesh_format::ChooseVertexFormat(source);
+    const graphics::mesh_buffer::IndexType    index_type = graphics::mesh_buffer::IndexTypeFor(num_verts);
+
+    utl::vector<u8> vertices{};
+    utl::vector<u8> indices{};
+    mesh_format::EncodeVertices(source, format, vertices);
+    mesh_format::EncodeIndices(source, index_type, indices);
+
+    mRange = graphics::mesh_buffer::Allocate(format, vertices.data(), num_verts, index_type, indices.data(),
+                                             mesh_format::TotalIndexCount(source));
+
+    u32 index_counts[mesh_format::max_lods]{ (u32) source.indices.size() };
+    f32 errors[mesh_format::max_lods]{};
+    for (u32 i = 0; i < (u32) source.lods.size(); ++i)
     {
-        LOG_WARN("Mesh '{}' is not version 1", filename);
-        return false;
+        index_counts[i + 1] = (u32) source.lods[i].indices.size();
+        errors[i + 1]       = source.lods[i].error;
     }
+    SetLods((u32) source.lods.size() + 1, index_counts, errors);
+}
 
-    mShaderName = doc["shader"].GetString();
-
-    const rapidjson::Value& textures = doc["textures"];
-    if (!textures.IsArray() || textures.Size() < 1)
+bool Mesh::Create(const MappedFile& file, bool async_textures)
+{
+    PROFILE_SCOPE("Upload mesh");
+    const mesh_format::Header* header = mesh_format::ValidateBinary(file.Data(), file.Size());
+    if (!header)
     {
-        LOG_WARN("Mesh '{}' has no textures. There should be at least one", filename);
         return false;
     }
 
-    mSpecularPower = (f32) doc["specularPower"].GetDouble();
+    const u8* base = (const u8*) file.Data();
 
-    for (rapidjson::SizeType i = 0; i < textures.Size(); ++i)
-    {
-        std::string textureName = textures[i].GetString();
-        Texture*    t           = core::GetTexture(textureName);
-        if (!t)
-        {
-            t = core::GetTexture("./Content/default.png");
-        }
-        mTextures.emplace_back(t);
-    }
+    mShaderName    = std::string{ header->shader_name, strnlen(header->shader_name, sizeof(header->shader_name)) };
+    mSpecularPower = header->specular_power;
+    mRadius        = header->radius;
+    mBoundsMin     = vec3{ header->bounds_min[0], header->bounds_min[1], header->bounds_min[2] };
+    mBoundsMax     = vec3{ header->bounds_max[0], header->bounds_max[1], header->bounds_max[2] };
 
-    constexpr u64 vertSize = 8;
+    ComputeBoundingSphere();
 
-    const rapidjson::Value& vertsJson = doc["vertices"];
-    if (!vertsJson.IsArray() || vertsJson.Size() < 1)
+    const auto* refs = (const mesh_format::TextureRef*) (base + sizeof(mesh_format::Header));
+    for (u32 i = 0; i < header->texture_count; ++i)
     {
-        LOG_WARN("Mesh '{}' has no vertices", filename);
-        return false;
+        AddTexture(std::string{ refs[i].path, strnlen(refs[i].path, mesh_format::max_name) }, async_textures);
     }
 
-    std::vector<f32> verts{};
-    verts.reserve(vertsJson.Size() * vertSize);
-    mRadius = 0.f;
-    for (rapidjson::SizeType i = 0; i < vertsJson.Size(); ++i)
+    // The blobs go from the mapped pages straight into the shared buffers
+    // already encoded by the converter, ValidateBinary checked the format and index size
+    u32 index_counts[mesh_format::max_lods]{ header->index_count };
+    f32 errors[mesh_format::max_lods]{};
+    u32 total_indices = header->index_count;
+    for (u32 i = 0; i < header->lod_count; ++i)
     {
-        const rapidjson::Value& vert = vertsJson[i];
-        if (!vert.IsArray() || vert.Size() != vertSize)
-        {
-            LOG_WARN("Unexptected vertex format in mesh '{}'", filename);
-            return false;
-        }
-
-        vec3 pos{ (f32) vert[0].GetDouble(), (f32) vert[1].GetDouble(), (f32) vert[2].GetDouble() };
-        mRadius = math::Max(mRadius, pos.LengthSq());
-
-        for (rapidjson::SizeType j = 0; j < vert.Size(); ++j)
-        {
-            verts.emplace_back((f32) vert[j].GetDouble());
-        }
+        index_counts[i + 1]  = header->lod_index_count[i];
+        errors[i + 1]        = header->lod_error[i];
+        total_indices       += header->lod_index_count[i];
     }
 
-    mRadius = math::Sqrt(mRadius);
+    const auto format = (graphics::mesh_buffer::VertexFormat) header->vertex_format;
+    mRange            = graphics::mesh_buffer::Allocate(format, base + header->vertex_offset, header->vertex_count,
+                                                        graphics::mesh_buffer::IndexTypeFor(header->vertex_count),
+                                                        base + header->index_offset, total_indices);
+    SetLods(header->lod_count + 1, index_counts, errors);
+    return true;
+}
 
-    const rapidjson::Value& indJson = doc["indices"];
-    if (!indJson.IsArray() || indJson.Size() < 1)
+void Mesh::AddTexture(const std::string& filename, bool async)
+{
+    if (async)
     {
-        LOG_WARN("Mesh '{}' has no indices", filename);
-        return false;
+        mTextures.emplace_back(core::GetTextureAsync(filename));
+        return;
     }
 
-    std::vector<u32> indices{};
-    indices.reserve(indJson.Size() * 3);
-
-    for (rapidjson::SizeType i = 0; i < indJson.Size(); ++i)
+    Texture* t = core::GetTexture(filename);
+    if (!t)
     {
-        const rapidjson::Value& ind = indJson[i];
-        if (!ind.IsArray() || ind.Size() != 3)
-        {
-            LOG_WARN("Invalid indices format for mesh '{}'", filename);
-            return false;
-        }
+        t = core::GetTexture(core::default_texture);
+    }
+    mTextures.emplace_back(t);
+}
 
-        indices.emplace_back(ind[0].GetUint());
-        indices.emplace_back(ind[1].GetUint());
-        indices.emplace_back(ind[2].GetUint());
+void Mesh::ComputeBoundingSphere()
+{
+    const vec3 half_extents = (mBoundsMax - mBoundsMin) * 0.5f;
+    if (half_extents.Length() < mRadius)
+    {
+        mSphereCenter = (mBoundsMin + mBoundsMax) * 0.5f;
+        mSphereRadius = half_extents.Length();
+    } else
+    {
+        mSphereCenter = math::zero_vec3;
+        mSphereRadius = mRadius;
     }
+}
 
-    mVertexArray = DBG_NEW VertexArray{ verts, (u32)verts.size() / (u32)vertSize, indices };
-    LOG_INFO("Mesh '{}' loaded", filename);
-    return true;
+void Mesh::SetLods(u32 lod_count, const u32* index_counts, const f32* errors)
+{
+    u32 first_index = mRange.first_index;
+    for (u32 i = 0; i < lod_count; ++i)
+    {
+        mLods[i]             = mRange;
+        mLods[i].first_index = first_index;
+        mLods[i].index_count = index_counts[i];
+        mLodErrors[i]        = errors[i];
+        first_index         += index_counts[i];
+    }
+    mLodCount = lod_count;
 }
 
 void Mesh::Unload()
 {
-    SAFE_DELETE(mVertexArray);
+    graphics::mesh_buffer::Free(mRange);
+    mLodCount = 0;
 }
 
 Texture* Mesh::GetTexture(u32 index) const
@@ -23,12 +23,13 @@
 
 #pragma once
 
+#include "MeshFormat.h"
 #include "Texture.h"
-#include "VertexArray.h"
 #include "Retract/Common.h"
 
 namespace retract
 {
+class MappedFile;
 
 class Mesh
 {
@@ -39,20 +40,49 @@ public:
     bool Load(const std::string& filename);
     void Unload();
 
+    // GL side of a load, the source has been read already (possibly on a loader thread).
+    // With async_textures the textures are requested through core::GetTextureAsync
+    void Create(const mesh_format::MeshSource& source, bool async_textures);
+    bool Create(const MappedFile& file, bool async_textures);
+
+    // False while an async load is still in flight, the renderer skips the mesh until then
+    constexpr bool IsLoaded() const { return mRange.IsValid(); }
+
     Texture* GetTexture(u32 index) const;
 
-    constexpr VertexArray* GetVertexArray() const { return mVertexArray; }
+    // Level 0 is the full mesh, the coarser levels index the same vertices in the shared mesh buffers
+    constexpr u32                                 LodCount() const { return mLodCount; }
+    constexpr const graphics::mesh_buffer::Range& GetRange(u32 lod = 0) const { return mLods[lod]; }
+    // How far the level strays from the full mesh, as a fraction of Radius()
+    constexpr f32                                 LodError(u32 lod) const { return mLodErrors[lod]; }
 
     constexpr const std::string& ShaderName() const { return mShaderName; }
     constexpr f32                Radius() const { return mRadius; }
     constexpr f32                SpecularPower() const { return mSpecularPower; }
+    constexpr const vec3&        BoundsMin() const { return mBoundsMin; }
+    constexpr const vec3&        BoundsMax() const { return mBoundsMax; }
+    // Model space culling sphere, the smaller of the one around the origin and the one around the bounds' center
+    constexpr const vec3&        SphereCenter() const { return mSphereCenter; }
+    constexpr f32                SphereRadius() const { return mSphereRadius; }
 
 private:
-    std::vector<Texture*> mTextures{};
-    VertexArray*          mVertexArray{};
-    std::string           mShaderName{};
-    f32                   mRadius{};
-    f32                   mSpecularPower{100.f};
+    void AddTexture(const std::string& filename, bool async);
+    void ComputeBoundingSphere();
+    // Splits mRange's indices into the levels, they're stored back to back starting with the full mesh
+    void SetLods(u32 lod_count, const u32* index_counts, const f32* errors);
+
+    std::vector<Texture*>        mTextures{};
+    graphics::mesh_buffer::Range mRange{}; // every level's indices
+    graphics::mesh_buffer::Range mLods[mesh_format::max_lods]{};
+    f32                          mLodErrors[mesh_format::max_lods]{};
+    u32                          mLodCount{};
+    std::string                  mShaderName{};
+    f32                          mRadius{};
+    f32                          mSpecularPower{100.f};
+    vec3                         mBoundsMin{};
+    vec3                         mBoundsMax{};
+    vec3                         mSphereCenter{};
+    f32                          mSphereRadius{};
 };
 
 } // namespace retract
\ No newline at end of file
@@ -0,0 +1,346 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MeshBuffer.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "MeshBuffer.h"
+#include "GLState.h"
+
+#include <GL/glew.h>
+
+namespace retract::graphics::mesh_buffer
+{
+
+namespace
+{
+constexpr u32 vertex_binding   = 0;
+constexpr u32 instance_binding = 1;
+
+// Per buffer set, they double when full
+constexpr u32 initial_vertices = 64 * 1024;
+constexpr u32 initial_indices  = 256 * 1024;
+
+// First fit over a sorted list of free spans, neighbours are merged on Free
+class RangeAllocator
+{
+public:
+    void Reset(u32 capacity)
+    {
+        mFree.clear();
+        mFree.emplace_back(Span{ 0, capacity });
+        mCapacity = capacity;
+    }
+
+    u32 Allocate(u32 count)
+    {
+        for (u32 i = 0; i < mFree.size(); ++i)
+        {
+            Span& span = mFree[i];
+            if (span.count < count)
+                continue;
+
+            const u32 offset = span.offset;
+            span.offset     += count;
+            span.count      -= count;
+            if (span.count == 0)
+            {
+                mFree.erase(mFree.begin() + i);
+            }
+            return offset;
+        }
+
+        return u32_invalid_id;
+    }
+
+    void Free(u32 offset, u32 count)
+    {
+        if (count == 0)
+            return;
+
+        u32 i = 0;
+        while (i < mFree.size() && mFree[i].offset < offset)
+        {
+            ++i;
+        }
+
+        mFree.insert(mFree.begin() + i, Span{ offset, count });
+        if (i + 1 < mFree.size() && mFree[i].offset + mFree[i].count == mFree[i + 1].offset)
+        {
+            mFree[i].count += mFree[i + 1].count;
+            mFree.erase(mFree.begin() + i + 1);
+        }
+        if (i > 0 && mFree[i - 1].offset + mFree[i - 1].count == mFree[i].offset)
+        {
+            mFree[i - 1].count += mFree[i].count;
+            mFree.erase(mFree.begin() + i);
+        }
+    }
+
+    // The new space joins the free span at the end, if there is one
+    void Grow(u32 capacity)
+    {
+        const u32 added = capacity - mCapacity;
+        Free(mCapacity, added);
+        mCapacity = capacity;
+    }
+
+    [[nodiscard]] constexpr u32 Capacity() const { return mCapacity; }
+
+private:
+    struct Span
+    {
+        u32 offset;
+        u32 count;
+    };
+
+    utl::vector<Span> mFree{};
+    u32               mCapacity{};
+};
+
+constexpr VertexLayout layouts[(u32) VertexFormat::count]{
+    // position_normal_uv
+    { 32,
+      3,
+      {
+          { 0, 3, GL_FLOAT, false, 0 },
+          { 1, 3, GL_FLOAT, false, 12 },
+          { 2, 2, GL_FLOAT, false, 24 },
+      } },
+    // packed
+    { 20,
+      3,
+      {
+          { 0, 3, GL_FLOAT, false, 0 },
+          { 1, 4, GL_INT_2_10_10_10_REV, true, 12 },
+          { 2, 2, GL_HALF_FLOAT, false, 16 },
+      } },
+};
+
+// The buffers and VAO behind one vertex format and index type
+struct BufferSet
+{
+    u32            vao{};
+    u32            vertex_buffer{};
+    u32            index_buffer{};
+    u32            draw_id_buffer{ u32_invalid_id };
+    RangeAllocator vertices{};
+    RangeAllocator indices{};
+};
+
+BufferSet sets[(u32) VertexFormat::count][(u32) IndexType::count]{};
+
+utl::vector<u32> free_mesh_ids{};
+u32              next_mesh_id{};
+
+BufferSet& Set(VertexFormat format, IndexType index_type)
+{
+    return sets[(u32) format][(u32) index_type];
+}
+
+u32 CreateBuffer(GLsizeiptr size)
+{
+    u32 buffer{};
+    glCreateBuffers(1, &buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STATIC_DRAW);
+    return buffer;
+}
+
+// New buffer of size with the old one's contents, the old one is deleted
+u32 GrowBuffer(u32 old_buffer, GLsizeiptr old_size, GLsizeiptr size)
+{
+    const u32 buffer = CreateBuffer(size);
+    glBindBuffer(GL_COPY_READ_BUFFER, old_buffer);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, old_size);
+    glDeleteBuffers(1, &old_buffer);
+    return buffer;
+}
+
+void AttachBuffers(VertexFormat format, IndexType index_type)
+{
+    const BufferSet& set = Set(format, index_type);
+    gl_state::BindVertexArray(set.vao);
+    glBindVertexBuffer(vertex_binding, set.vertex_buffer, 0, (i32) Layout(format).stride);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, set.index_buffer);
+}
+
+void CreateSet(VertexFormat format, IndexType index_type)
+{
+    BufferSet&          set    = Set(format, index_type);
+    const VertexLayout& layout = Layout(format);
+
+    set.vertex_buffer = CreateBuffer((GLsizeiptr) initial_vertices * layout.stride);
+    set.index_buffer  = CreateBuffer((GLsizeiptr) initial_indices * IndexSize(index_type));
+    set.vertices.Reset(initial_vertices);
+    set.indices.Reset(initial_indices);
+
+    glCreateVertexArrays(1, &set.vao);
+    AttachBuffers(format, index_type);
+
+    // Attribute layouts are set once, growing a buffer only rebinds it
+    for (u32 i = 0; i < layout.attribute_count; ++i)
+    {
+        const VertexAttribute& attribute = layout.attributes[i];
+        glEnableVertexAttribArray(attribute.location);
+        glVertexAttribFormat(attribute.location, (i32) attribute.components, attribute.type, attribute.normalized,
+                             attribute.offset);
+        glVertexAttribBinding(attribute.location, vertex_binding);
+    }
+
+    // Index of the instance's entry in the renderer's per instance data
+    glEnableVertexAttribArray(3);
+    glVertexAttribIFormat(3, 1, GL_UNSIGNED_INT, 0);
+    glVertexAttribBinding(3, instance_binding);
+    glVertexBindingDivisor(instance_binding, 1);
+}
+
+// Doubles until count more fits at the end. Existing ranges keep their offsets. Element counts have to stay below
+// u32_invalid_id since ranges store u32 offsets, byte sizes are worked out in 64 bits
+void Reserve(RangeAllocator& allocator, u32& buffer, u32 element_size, u32 count)
+{
+    constexpr u64 max_capacity = u32_invalid_id;
+    const u64     old_capacity = allocator.Capacity();
+    assert(old_capacity + count <= max_capacity && "Mesh buffer element count overflows u32");
+
+    u64 capacity = old_capacity;
+    while (capacity - old_capacity < count)
+    {
+        capacity = math::Min(capacity * 2, max_capacity);
+    }
+
+    const u64 old_size = old_capacity * element_size;
+    const u64 size     = capacity * element_size;
+    assert(size <= (u64) std::numeric_limits<GLsizeiptr>::max() && "Mesh buffer size overflows GLsizeiptr");
+
+    LOG_INFO("Growing mesh buffer from {} to {} elements", old_capacity, capacity);
+    buffer = GrowBuffer(buffer, (GLsizeiptr) old_size, (GLsizeiptr) size);
+    allocator.Grow((u32) capacity);
+}
+} // anonymous namespace
+
+u32 IndexGLType(IndexType type)
+{
+    return type == IndexType::u16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+}
+
+const VertexLayout& Layout(VertexFormat format)
+{
+    assert(format < VertexFormat::count);
+    return layouts[(u32) format];
+}
+
+bool Initialize()
+{
+    for (u32 format = 0; format < (u32) VertexFormat::count; ++format)
+    {
+        for (u32 index_type = 0; index_type < (u32) IndexType::count; ++index_type)
+        {
+            CreateSet((VertexFormat) format, (IndexType) index_type);
+        }
+    }
+    return true;
+}
+
+void Shutdown()
+{
+    for (auto& format_sets : sets)
+    {
+        for (BufferSet& set : format_sets)
+        {
+            gl_state::ForgetVertexArray(set.vao);
+            glDeleteVertexArrays(1, &set.vao);
+            glDeleteBuffers(1, &set.vertex_buffer);
+            glDeleteBuffers(1, &set.index_buffer);
+            set = {};
+        }
+    }
+
+    free_mesh_ids.clear();
+    next_mesh_id = 0;
+}
+
+Range Allocate(VertexFormat format, const void* vertices, u32 vertex_count, IndexType index_type, const void* indices,
+               u32 index_count)
+{
+    BufferSet& set        = Set(format, index_type);
+    const u32  stride     = Layout(format).stride;
+    const u32  index_size = IndexSize(index_type);
+
+    Range range{ .vertex_count = vertex_count, .index_count = index_count, .format = format, .index_type = index_type };
+
+    if (free_mesh_ids.empty())
+    {
+        range.mesh_id = next_mesh_id++;
+    } else
+    {
+        range.mesh_id = free_mesh_ids.back();
+        free_mesh_ids.pop_back();
+    }
+
+    range.base_vertex = set.vertices.Allocate(vertex_count);
+    if (range.base_vertex == u32_invalid_id)
+    {
+        Reserve(set.vertices, set.vertex_buffer, stride, vertex_count);
+        AttachBuffers(format, index_type);
+        range.base_vertex = set.vertices.Allocate(vertex_count);
+    }
+
+    range.first_index = set.indices.Allocate(index_count);
+    if (range.first_index == u32_invalid_id)
+    {
+        Reserve(set.indices, set.index_buffer, index_size, index_count);
+        AttachBuffers(format, index_type);
+        range.first_index = set.indices.Allocate(index_count);
+    }
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, set.vertex_buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr) range.base_vertex * stride, (GLsizeiptr) vertex_count * stride, vertices);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, set.index_buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr) range.first_index * index_size, (GLsizeiptr) index_count * index_size,
+                    indices);
+
+    return range;
+}
+
+void Free(Range& range)
+{
+    if (!range.IsValid())
+        return;
+
+    BufferSet& set = Set(range.format, range.index_type);
+    set.vertices.Free(range.base_vertex, range.vertex_count);
+    set.indices.Free(range.first_index, range.index_count);
+    free_mesh_ids.emplace_back(range.mesh_id);
+    range = {};
+}
+
+void Activate(VertexFormat format, IndexType index_type, u32 draw_id_buffer)
+{
+    BufferSet& set = Set(format, index_type);
+    gl_state::BindVertexArray(set.vao);
+    if (set.draw_id_buffer != draw_id_buffer)
+    {
+        set.draw_id_buffer = draw_id_buffer;
+        glBindVertexBuffer(instance_binding, draw_id_buffer, 0, sizeof(u32));
+    }
+}
+
+} // namespace retract::graphics::mesh_buffer
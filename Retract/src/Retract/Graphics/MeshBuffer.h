@@ -0,0 +1,116 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MeshBuffer.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Common.h"
+
+// Every mesh's vertices and indices live in a few large buffers shared by all meshes of a vertex format and index
+// type, with one VAO per pair. A mesh is a range in them, drawn through base vertex / first index offsets so switching
+// meshes doesn't touch any GL binding
+namespace retract::graphics::mesh_buffer
+{
+
+enum class VertexFormat : u8
+{
+    // 8 floats: position, normal, tex coords. 32 bytes
+    position_normal_uv,
+    // Position as 3 floats, normal as GL_INT_2_10_10_10_REV, tex coords as 2 half floats. 20 bytes
+    packed,
+
+    count
+};
+
+enum class IndexType : u8
+{
+    u16,
+    u32,
+
+    count
+};
+
+// One attribute of a vertex format. type is the GL enum of a component
+struct VertexAttribute
+{
+    u32  location;
+    u32  components;
+    u32  type;
+    bool normalized;
+    u32  offset;
+};
+
+struct VertexLayout
+{
+    static constexpr u32 max_attributes = 4;
+
+    u32             stride;
+    u32             attribute_count;
+    VertexAttribute attributes[max_attributes];
+};
+
+const VertexLayout& Layout(VertexFormat format);
+
+constexpr u32 IndexSize(IndexType type)
+{
+    return type == IndexType::u16 ? sizeof(u16) : sizeof(u32);
+}
+
+// GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, for the draw calls
+u32 IndexGLType(IndexType type);
+
+// 16 bit indices whenever every vertex can be reached with them
+constexpr IndexType IndexTypeFor(u32 vertex_count)
+{
+    return vertex_count <= 0x10000 ? IndexType::u16 : IndexType::u32;
+}
+
+// Where a mesh sits in its buffers, first_index counts in index_type units. Indices are stored relative to the mesh,
+// draws add base_vertex. mesh_id is unique among live ranges and reused after Free, so it stays small
+struct Range
+{
+    u32          mesh_id{ u32_invalid_id };
+    u32          base_vertex{ u32_invalid_id };
+    u32          vertex_count{};
+    u32          first_index{ u32_invalid_id };
+    u32          index_count{};
+    VertexFormat format{};
+    IndexType    index_type{};
+
+    [[nodiscard]] constexpr bool IsValid() const { return first_index != u32_invalid_id; }
+};
+
+bool Initialize();
+void Shutdown();
+
+// Copies the data into the shared buffers, growing them when there is no room. vertices are laid out as format,
+// indices as index_type
+Range Allocate(VertexFormat format, const void* vertices, u32 vertex_count, IndexType index_type, const void* indices,
+               u32 index_count);
+// The range is reset and its space reused by later allocations
+void  Free(Range& range);
+
+// Binds the VAO for format and index_type, reading each instance's u32 draw id (location 3) from draw_id_buffer
+void Activate(VertexFormat format, IndexType index_type, u32 draw_id_buffer);
+
+} // namespace retract::graphics::mesh_buffer
@@ -0,0 +1,440 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MeshFormat.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "MeshFormat.h"
+
+#include "Retract/Util/MappedFile.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <rapidjson/document.h>
+
+namespace retract::mesh_format
+{
+
+namespace
+{
+constexpr u32 AlignUp(u32 value, u32 alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Dropping the low shift bits of value, rounding half to even
+constexpr u32 RoundShift(u32 value, u32 shift)
+{
+    const u32 rest = value & ((1u << shift) - 1);
+    const u32 half = 1u << (shift - 1);
+    value        >>= shift;
+    return value + (rest > half || (rest == half && (value & 1)));
+}
+
+// Round to nearest even like the F16C conversion, out of range values and NaN become infinity
+u16 ToHalf(f32 value)
+{
+    u32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const u32 sign     = (bits >> 16) & 0x8000;
+    const i32 exponent = (i32) ((bits >> 23) & 0xff) - 127 + 15;
+    u32       mantissa = bits & 0x7fffff;
+
+    if (exponent <= 0)
+    {
+        // Subnormal, or too small for anything but zero
+        if (exponent < -10)
+            return (u16) sign;
+
+        return (u16) (sign | RoundShift(mantissa | 0x800000, (u32) (14 - exponent)));
+    }
+
+    if (exponent >= 31)
+        return (u16) (sign | 0x7c00);
+
+    // A carry out of the mantissa correctly bumps the exponent
+    return (u16) (sign | (((u32) exponent << 10) + RoundShift(mantissa, 13)));
+}
+
+// Signed normalized 10 bit x, y, z with w left at 0
+u32 PackNormal(const vec3& normal)
+{
+    const auto component = [](f32 value) { return (u32) (i32) std::lround(math::Clamp(value, -1.f, 1.f) * 511.f) & 0x3ff; };
+    return component(normal.x) | (component(normal.y) << 10) | (component(normal.z) << 20);
+}
+} // anonymous namespace
+
+bool ReadGpMesh(const std::string& filename, MeshSource& out)
+{
+    PROFILE_SCOPE("Parse gpmesh");
+    // Parse straight out of the mapped file rather than copying it through a stringstream first
+    const MappedFile file{ filename };
+    if (!file.IsOpen())
+    {
+        LOG_WARN("Mesh file not found: {}", filename);
+        return false;
+    }
+
+    rapidjson::Document doc{};
+    doc.Parse((const char*) file.Data(), (size_t) file.Size());
+
+    // Every member is checked before it is read, rapidjson asserts on missing members and wrong types
+    if (!doc.IsObject())
+    {
+        LOG_ERROR("Mesh '{}' is not a valid json object", filename);
+        return false;
+    }
+
+    if (!doc.HasMember("version") || !doc["version"].IsInt() || doc["version"].GetInt() != 1)
+    {
+        LOG_ERROR("Mesh '{}' is not version 1", filename);
+        return false;
+    }
+
+    // PosNormTex is the only layout .gpmesh files come in, it's what the 8 floats per vertex below hold
+    if (doc.HasMember("vertexformat") && !doc["vertexformat"].IsString())
+    {
+        LOG_ERROR("Mesh '{}' has a vertex format that is not a string", filename);
+        return false;
+    }
+    out.vertex_format = doc.HasMember("vertexformat") ? doc["vertexformat"].GetString() : "PosNormTex";
+    if (out.vertex_format != "PosNormTex")
+    {
+        LOG_ERROR("Mesh '{}' has unsupported vertex format '{}'", filename, out.vertex_format);
+        return false;
+    }
+
+    if (!doc.HasMember("shader") || !doc["shader"].IsString())
+    {
+        LOG_ERROR("Mesh '{}' has no shader name", filename);
+        return false;
+    }
+    out.shader_name = doc["shader"].GetString();
+
+    if (!doc.HasMember("specularPower") || !doc["specularPower"].IsNumber())
+    {
+        LOG_ERROR("Mesh '{}' has no specular power", filename);
+        return false;
+    }
+    out.specular_power = doc["specularPower"].GetFloat();
+
+    if (!doc.HasMember("textures") || !doc["textures"].IsArray() || doc["textures"].Size() < 1)
+    {
+        LOG_ERROR("Mesh '{}' has no textures. There should be at least one", filename);
+        return false;
+    }
+
+    const rapidjson::Value& textures = doc["textures"];
+    out.textures.clear();
+    for (rapidjson::SizeType i = 0; i < textures.Size(); ++i)
+    {
+        if (!textures[i].IsString())
+        {
+            LOG_ERROR("Mesh '{}' has a texture name that is not a string", filename);
+            return false;
+        }
+        out.textures.emplace_back(textures[i].GetString());
+    }
+
+    if (!doc.HasMember("vertices") || !doc["vertices"].IsArray() || doc["vertices"].Size() < 1)
+    {
+        LOG_ERROR("Mesh '{}' has no vertices", filename);
+        return false;
+    }
+    const rapidjson::Value& vertsJson = doc["vertices"];
+
+    out.vertices.resize((u64) vertsJson.Size() * floats_per_vertex);
+    out.bounds_min = vec3{ math::infinity, math::infinity, math::infinity };
+    out.bounds_max = vec3{ math::neg_infinity, math::neg_infinity, math::neg_infinity };
+    f32  radius_sq = 0.f;
+    f32* dst       = out.vertices.data();
+    for (rapidjson::SizeType i = 0; i < vertsJson.Size(); ++i)
+    {
+        const rapidjson::Value& vert = vertsJson[i];
+        if (!vert.IsArray() || vert.Size() != floats_per_vertex)
+        {
+            LOG_ERROR("Unexptected vertex format in mesh '{}'", filename);
+            return false;
+        }
+
+        for (u32 j = 0; j < floats_per_vertex; ++j)
+        {
+            if (!vert[j].IsNumber())
+            {
+                LOG_ERROR("Mesh '{}' has a vertex component that is not a number", filename);
+                return false;
+            }
+            *dst++ = vert[j].GetFloat();
+        }
+
+        const vec3 pos{ dst[-8], dst[-7], dst[-6] };
+        radius_sq = math::Max(radius_sq, pos.LengthSq());
+
+        out.bounds_min.x = math::Min(out.bounds_min.x, pos.x);
+        out.bounds_min.y = math::Min(out.bounds_min.y, pos.y);
+        out.bounds_min.z = math::Min(out.bounds_min.z, pos.z);
+        out.bounds_max.x = math::Max(out.bounds_max.x, pos.x);
+        out.bounds_max.y = math::Max(out.bounds_max.y, pos.y);
+        out.bounds_max.z = math::Max(out.bounds_max.z, pos.z);
+    }
+
+    out.radius = math::Sqrt(radius_sq);
+
+    if (!doc.HasMember("indices") || !doc["indices"].IsArray() || doc["indices"].Size() < 1)
+    {
+        LOG_ERROR("Mesh '{}' has no indices", filename);
+        return false;
+    }
+    const rapidjson::Value& indJson = doc["indices"];
+
+    out.indices.resize((u64) indJson.Size() * 3);
+    u32* ind_dst = out.indices.data();
+    for (rapidjson::SizeType i = 0; i < indJson.Size(); ++i)
+    {
+        const rapidjson::Value& ind = indJson[i];
+        if (!ind.IsArray() || ind.Size() != 3)
+        {
+            LOG_ERROR("Invalid indices format for mesh '{}'", filename);
+            return false;
+        }
+
+        for (rapidjson::SizeType j = 0; j < 3; ++j)
+        {
+            if (!ind[j].IsUint())
+            {
+                LOG_ERROR("Mesh '{}' has an index that is not an unsigned integer", filename);
+                return false;
+            }
+
+            const u32 index = ind[j].GetUint();
+            if (index >= vertsJson.Size())
+            {
+                LOG_ERROR("Mesh '{}' has an index past its last vertex", filename);
+                return false;
+            }
+            *ind_dst++ = index;
+        }
+    }
+
+    return true;
+}
+
+graphics::mesh_buffer::VertexFormat ChooseVertexFormat(const MeshSource& mesh)
+{
+    for (u64 i = 0; i < mesh.vertices.size(); i += floats_per_vertex)
+    {
+        if (math::Abs(mesh.vertices[i + 6]) > max_packed_uv || math::Abs(mesh.vertices[i + 7]) > max_packed_uv)
+            return graphics::mesh_buffer::VertexFormat::position_normal_uv;
+    }
+
+    return graphics::mesh_buffer::VertexFormat::packed;
+}
+
+void EncodeVertices(const MeshSource& mesh, graphics::mesh_buffer::VertexFormat format, utl::vector<u8>& out)
+{
+    const u32 vertex_count = (u32) (mesh.vertices.size() / floats_per_vertex);
+    out.resize((u64) vertex_count * graphics::mesh_buffer::Layout(format).stride);
+
+    if (format == graphics::mesh_buffer::VertexFormat::position_normal_uv)
+    {
+        std::memcpy(out.data(), mesh.vertices.data(), out.size());
+        return;
+    }
+
+    auto* packed = (PackedVertex*) out.data();
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        const f32* src = mesh.vertices.data() + (u64) i * floats_per_vertex;
+
+        packed[i].position[0] = src[0];
+        packed[i].position[1] = src[1];
+        packed[i].position[2] = src[2];
+        packed[i].normal      = PackNormal(math::Normalize(vec3{ src[3], src[4], src[5] }));
+        packed[i].uv[0]       = ToHalf(src[6]);
+        packed[i].uv[1]       = ToHalf(src[7]);
+    }
+}
+
+u32 TotalIndexCount(const MeshSource& mesh)
+{
+    u64 count = mesh.indices.size();
+    for (const MeshLod& lod : mesh.lods)
+    {
+        count += lod.indices.size();
+    }
+    return (u32) count;
+}
+
+void EncodeIndices(const MeshSource& mesh, graphics::mesh_buffer::IndexType index_type, utl::vector<u8>& out)
+{
+    const u32 index_size = graphics::mesh_buffer::IndexSize(index_type);
+    out.resize((u64) TotalIndexCount(mesh) * index_size);
+
+    u8*        dst    = out.data();
+    const auto encode = [&](const utl::vector<u32>& indices) {
+        if (index_type == graphics::mesh_buffer::IndexType::u32)
+        {
+            std::memcpy(dst, indices.data(), indices.size() * sizeof(u32));
+        } else
+        {
+            for (u64 i = 0; i < indices.size(); ++i)
+            {
+                ((u16*) dst)[i] = (u16) indices[i];
+            }
+        }
+        dst += indices.size() * index_size;
+    };
+
+    encode(mesh.indices);
+    for (const MeshLod& lod : mesh.lods)
+    {
+        encode(lod.indices);
+    }
+}
+
+bool WriteBinary(const std::string& filename, const MeshSource& mesh)
+{
+    if (mesh.shader_name.size() >= sizeof(Header::shader_name))
+    {
+        LOG_WARN("Shader name '{}' is too long for the binary mesh format", mesh.shader_name);
+        return false;
+    }
+
+    if (mesh.lods.size() >= max_lods)
+    {
+        LOG_WARN("Mesh has {} LODs, the binary mesh format holds {}", mesh.lods.size(), max_lods - 1);
+        return false;
+    }
+
+    const u32                                 vertex_count = (u32) (mesh.vertices.size() / floats_per_vertex);
+    const graphics::mesh_buffer::VertexFormat format       = ChooseVertexFormat(mesh);
+    const graphics::mesh_buffer::IndexType    index_type   = graphics::mesh_buffer::IndexTypeFor(vertex_count);
+
+    utl::vector<u8> vertices{};
+    utl::vector<u8> indices{};
+    EncodeVertices(mesh, format, vertices);
+    EncodeIndices(mesh, index_type, indices);
+
+    Header header{};
+    header.magic          = magic;
+    header.version        = version;
+    header.vertex_count   = vertex_count;
+    header.vertex_stride  = graphics::mesh_buffer::Layout(format).stride;
+    header.vertex_format  = (u32) format;
+    header.index_size     = graphics::mesh_buffer::IndexSize(index_type);
+    header.index_count    = (u32) mesh.indices.size();
+    header.texture_count  = (u32) mesh.textures.size();
+    header.specular_power = mesh.specular_power;
+    header.radius         = mesh.radius;
+    header.bounds_min[0]  = mesh.bounds_min.x;
+    header.bounds_min[1]  = mesh.bounds_min.y;
+    header.bounds_min[2]  = mesh.bounds_min.z;
+    header.bounds_max[0]  = mesh.bounds_max.x;
+    header.bounds_max[1]  = mesh.bounds_max.y;
+    header.bounds_max[2]  = mesh.bounds_max.z;
+    std::memcpy(header.shader_name, mesh.shader_name.c_str(), mesh.shader_name.size());
+
+    header.lod_count = (u32) mesh.lods.size();
+    for (u32 i = 0; i < header.lod_count; ++i)
+    {
+        header.lod_index_count[i] = (u32) mesh.lods[i].indices.size();
+        header.lod_error[i]       = mesh.lods[i].error;
+    }
+
+    const u32 textures_end = (u32) sizeof(Header) + header.texture_count * (u32) sizeof(TextureRef);
+    header.vertex_offset   = AlignUp(textures_end, 16);
+    header.index_offset    = header.vertex_offset + header.vertex_count * header.vertex_stride;
+
+    utl::vector<TextureRef> refs(header.texture_count);
+    for (u32 i = 0; i < header.texture_count; ++i)
+    {
+        if (mesh.textures[i].size() >= max_name)
+        {
+            LOG_WARN("Texture path '{}' is too long for the binary mesh format", mesh.textures[i]);
+            return false;
+        }
+        std::memcpy(refs[i].path, mesh.textures[i].c_str(), mesh.textures[i].size());
+    }
+
+    std::ofstream file{ filename, std::ios::binary };
+    if (!file.is_open())
+    {
+        LOG_WARN("Could not open '{}' for writing", filename);
+        return false;
+    }
+
+    constexpr char padding[16]{};
+    file.write((const char*) &header, sizeof(Header));
+    file.write((const char*) refs.data(), (std::streamsize) (refs.size() * sizeof(TextureRef)));
+    file.write(padding, header.vertex_offset - textures_end);
+    file.write((const char*) vertices.data(), (std::streamsize) vertices.size());
+    file.write((const char*) indices.data(), (std::streamsize) indices.size());
+
+    return file.good();
+}
+
+const Header* ValidateBinary(const void* data, u64 size)
+{
+    if (!data || size < sizeof(Header))
+        return nullptr;
+
+    const Header* header = (const Header*) data;
+    if (header->magic != magic || header->version != version)
+        return nullptr;
+
+    if (header->vertex_format >= (u32) graphics::mesh_buffer::VertexFormat::count)
+        return nullptr;
+
+    const auto format = (graphics::mesh_buffer::VertexFormat) header->vertex_format;
+    if (header->vertex_stride != graphics::mesh_buffer::Layout(format).stride ||
+        header->index_size != graphics::mesh_buffer::IndexSize(graphics::mesh_buffer::IndexTypeFor(header->vertex_count)))
+        return nullptr;
+
+    if (header->lod_count >= max_lods)
+        return nullptr;
+
+    u64 total_indices = header->index_count;
+    for (u32 i = 0; i < header->lod_count; ++i)
+    {
+        total_indices += header->lod_index_count[i];
+    }
+
+    const u64 textures_end = sizeof(Header) + (u64) header->texture_count * sizeof(TextureRef);
+    const u64 vertices_end = (u64) header->vertex_offset + (u64) header->vertex_count * header->vertex_stride;
+    const u64 indices_end  = (u64) header->index_offset + total_indices * header->index_size;
+    if (header->vertex_offset < textures_end || header->index_offset < vertices_end || indices_end > size)
+        return nullptr;
+
+    return header;
+}
+
+std::string BinaryPath(const std::string& filename)
+{
+    const size_t dot = filename.find_last_of('.');
+    const size_t sep = filename.find_last_of("/\\");
+    if (dot == std::string::npos || (sep != std::string::npos && dot < sep))
+        return filename + ".rmesh";
+
+    return filename.substr(0, dot) + ".rmesh";
+}
+
+} // namespace retract::mesh_format
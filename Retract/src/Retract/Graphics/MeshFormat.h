@@ -0,0 +1,127 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MeshFormat.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "MeshBuffer.h"
+#include "Retract/Common.h"
+
+namespace retract::mesh_format
+{
+
+// .rmesh layout, little endian:
+//   Header
+//   TextureRef[texture_count]
+//   vertex blob (interleaved, in vertex_format, vertex_stride bytes each) at vertex_offset, 16 byte aligned
+//   index blob (index_size bytes each) at index_offset, the full mesh's index_count indices followed by each LOD's
+// The blobs are exactly what glBufferData wants, so a mapped file can be uploaded without copying.
+
+constexpr u32 magic             = 0x48534D52; // "RMSH"
+constexpr u32 version           = 3;
+constexpr u32 floats_per_vertex = 8; // position, normal, tex coords
+constexpr u32 max_name          = 128;
+constexpr u32 max_lods          = 4; // including the full mesh
+
+// Tex coords beyond this lose too much precision as half floats, meshes using them keep full float vertices
+constexpr f32 max_packed_uv = 2.f;
+
+struct Header
+{
+    u32  magic;
+    u32  version;
+    u32  vertex_count;
+    u32  vertex_stride;
+    u32  vertex_format; // graphics::mesh_buffer::VertexFormat
+    u32  index_size;    // 2 or 4
+    u32  index_count;
+    u32  texture_count;
+    u32  vertex_offset;
+    u32  index_offset;
+    f32  specular_power;
+    f32  radius;
+    f32  bounds_min[3];
+    f32  bounds_max[3];
+    char shader_name[32];
+    u32  lod_count; // levels past the full mesh, they index the same vertices
+    u32  lod_index_count[max_lods - 1];
+    f32  lod_error[max_lods - 1]; // fraction of radius
+};
+static_assert(sizeof(Header) == 132);
+
+struct TextureRef
+{
+    char path[max_name];
+};
+
+// VertexFormat::packed, 20 bytes
+struct PackedVertex
+{
+    f32 position[3];
+    u32 normal; // GL_INT_2_10_10_10_REV
+    u16 uv[2];  // half floats
+};
+static_assert(sizeof(PackedVertex) == 20);
+
+// A simplified version of a mesh over its vertices. error is how far it strays from the full mesh, as a fraction of
+// the mesh's radius
+struct MeshLod
+{
+    utl::vector<u32> indices{};
+    f32              error{};
+};
+
+// Mesh data as parsed from a .gpmesh, before it goes to the GPU or out to a .rmesh.
+// Vertices are always floats_per_vertex floats here, they're packed on the way out
+struct MeshSource
+{
+    std::string              vertex_format{};
+    std::string              shader_name{};
+    utl::vector<std::string> textures{};
+    utl::vector<f32>         vertices{};
+    utl::vector<u32>         indices{};
+    utl::vector<MeshLod>     lods{}; // filled in by mesh_optimizer, at most max_lods - 1
+    f32                      specular_power{ 100.f };
+    f32                      radius{};
+    vec3                     bounds_min{};
+    vec3                     bounds_max{};
+};
+
+bool ReadGpMesh(const std::string& filename, MeshSource& out);
+
+// The full mesh's and every LOD's indices
+u32 TotalIndexCount(const MeshSource& mesh);
+
+// The packed format unless the tex coords need full floats
+graphics::mesh_buffer::VertexFormat ChooseVertexFormat(const MeshSource& mesh);
+// The mesh's vertices laid out as format and its indices, then every LOD's, as index_type
+void EncodeVertices(const MeshSource& mesh, graphics::mesh_buffer::VertexFormat format, utl::vector<u8>& out);
+void EncodeIndices(const MeshSource& mesh, graphics::mesh_buffer::IndexType index_type, utl::vector<u8>& out);
+bool WriteBinary(const std::string& filename, const MeshSource& mesh);
+
+// Checks magic, version and that every blob fits inside size. nullptr if data is not a usable .rmesh
+const Header* ValidateBinary(const void* data, u64 size);
+
+// "Content/Ship.gpmesh" -> "Content/Ship.rmesh"
+std::string BinaryPath(const std::string& filename);
+
+} // namespace retract::mesh_format
@@ -0,0 +1,784 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MeshOptimizer.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <tuple>
+#include <unordered_set>
+
+namespace retract::mesh_optimizer
+{
+
+namespace
+{
+// Forsyth's scoring constants. The scores model an LRU cache of score_cache_size, bigger than any real FIFO cache so
+// the order degrades gracefully on whatever the hardware has
+constexpr u32 score_cache_size    = 32;
+constexpr f32 cache_decay_power   = 1.5f;
+constexpr f32 last_triangle_score = 0.75f;
+constexpr f32 valence_boost_scale = 2.f;
+constexpr f32 valence_boost_power = 0.5f;
+constexpr u32 max_scored_valence  = 32;
+
+constexpr u32 vertex_size = mesh_format::floats_per_vertex * sizeof(f32);
+
+struct ScoreTables
+{
+    f32 cache[score_cache_size];
+    f32 valence[max_scored_valence];
+};
+
+ScoreTables MakeScoreTables()
+{
+    ScoreTables tables{};
+    for (u32 i = 0; i < score_cache_size; ++i)
+    {
+        // The last triangle's vertices score a little lower so the next one doesn't reuse the same edge forever
+        tables.cache[i] = i < 3 ? last_triangle_score
+                                : std::pow(1.f - (f32) (i - 3) / (f32) (score_cache_size - 3), cache_decay_power);
+    }
+
+    for (u32 i = 1; i < max_scored_valence; ++i)
+    {
+        // Vertices with few triangles left are finished first so they can leave the cache
+        tables.valence[i] = valence_boost_scale * std::pow((f32) i, -valence_boost_power);
+    }
+
+    return tables;
+}
+
+f32 VertexScore(const ScoreTables& tables, i32 cache_position, u32 valence)
+{
+    if (valence == 0)
+        return -1.f;
+
+    const f32 cache = cache_position < 0 ? 0.f : tables.cache[cache_position];
+    return cache + tables.valence[math::Min(valence, max_scored_valence - 1)];
+}
+
+// FIFO post-transform cache through timestamps, a vertex is cached while fewer than size misses happened since it
+// was loaded
+class FifoCache
+{
+public:
+    FifoCache(u32 vertex_count, u32 size) : mLoaded(vertex_count, 0), mSize(size), mTime(size + 1) {}
+
+    // 1 when the vertex had to be transformed
+    u32 Touch(u32 vertex)
+    {
+        if (mTime - mLoaded[vertex] <= mSize)
+            return 0;
+
+        mLoaded[vertex] = mTime++;
+        return 1;
+    }
+
+    u32 Triangle(const u32* indices) { return Touch(indices[0]) + Touch(indices[1]) + Touch(indices[2]); }
+
+    void Reset() { mTime += mSize + 1; }
+
+private:
+    utl::vector<u32> mLoaded;
+    u32              mSize;
+    u32              mTime;
+};
+
+u32 VertexCount(const mesh_format::MeshSource& mesh)
+{
+    return (u32) (mesh.vertices.size() / mesh_format::floats_per_vertex);
+}
+
+vec3 Position(const mesh_format::MeshSource& mesh, u32 vertex)
+{
+    const f32* v = mesh.vertices.data() + (u64) vertex * mesh_format::floats_per_vertex;
+    return vec3{ v[0], v[1], v[2] };
+}
+
+u32 HashVertex(const u8* vertex)
+{
+    // FNV-1a
+    u32 hash = 2166136261u;
+    for (u32 i = 0; i < vertex_size; ++i)
+    {
+        hash = (hash ^ vertex[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Forsyth. Reorders the triangles of indices, the vertices stay where they are
+void CacheOrder(utl::vector<u32>& indices, u32 vertex_count)
+{
+    const u32 triangle_count = (u32) (indices.size() / 3);
+    if (triangle_count < 2)
+        return;
+
+    const ScoreTables tables = MakeScoreTables();
+
+    // Triangles using each vertex, packed per vertex. valence counts the ones not emitted yet and is also the live
+    // length of the vertex's list, emitted triangles are swapped past the end
+    utl::vector<u32> valence(vertex_count, 0);
+    utl::vector<u32> adjacency_offset(vertex_count + 1, 0);
+    utl::vector<u32> adjacency(indices.size());
+    for (u32 index : indices)
+    {
+        ++valence[index];
+    }
+    for (u32 v = 0; v < vertex_count; ++v)
+    {
+        adjacency_offset[v + 1] = adjacency_offset[v] + valence[v];
+    }
+    {
+        utl::vector<u32> fill(adjacency_offset.begin(), adjacency_offset.end() - 1);
+        for (u32 i = 0; i < (u32) indices.size(); ++i)
+        {
+            adjacency[fill[indices[i]]++] = i / 3;
+        }
+    }
+
+    utl::vector<i32> cache_position(vertex_count, -1);
+    utl::vector<f32> vertex_score(vertex_count);
+    for (u32 v = 0; v < vertex_count; ++v)
+    {
+        vertex_score[v] = VertexScore(tables, -1, valence[v]);
+    }
+
+    const auto score_triangle = [&](u32 t) {
+        return vertex_score[indices[t * 3]] + vertex_score[indices[t * 3 + 1]] + vertex_score[indices[t * 3 + 2]];
+    };
+
+    utl::vector<f32> triangle_score(triangle_count);
+    utl::vector<u8>  emitted(triangle_count, 0);
+    u32              best = 0;
+    for (u32 t = 0; t < triangle_count; ++t)
+    {
+        triangle_score[t] = score_triangle(t);
+        if (triangle_score[t] > triangle_score[best])
+            best = t;
+    }
+
+    utl::vector<u32> ordered{};
+    ordered.reserve(indices.size());
+
+    u32 cache[score_cache_size + 3];
+    u32 new_cache[score_cache_size + 3];
+    u32 cache_count    = 0;
+    u32 next_unemitted = 0;
+    for (;;)
+    {
+        if (best == u32_invalid_id)
+        {
+            // Nothing in the cache has triangles left, carry on with the next one in the original order
+            while (next_unemitted < triangle_count && emitted[next_unemitted])
+            {
+                ++next_unemitted;
+            }
+            if (next_unemitted == triangle_count)
+                break;
+
+            best = next_unemitted;
+        }
+
+        const u32* tri = indices.data() + (u64) best * 3;
+        emitted[best]  = 1;
+        ordered.insert(ordered.end(), tri, tri + 3);
+
+        // LRU: the triangle's vertices move to the front, ahead of the rest of the old cache
+        u32 new_count = 0;
+        for (u32 k = 0; k < 3; ++k)
+        {
+            if (std::find(new_cache, new_cache + new_count, tri[k]) == new_cache + new_count)
+                new_cache[new_count++] = tri[k];
+
+            u32*      list  = adjacency.data() + adjacency_offset[tri[k]];
+            const u32 count = valence[tri[k]];
+            u32*      found = std::find(list, list + count, best);
+            if (found != list + count)
+            {
+                std::swap(*found, list[count - 1]);
+                --valence[tri[k]];
+            }
+        }
+        for (u32 c = 0; c < cache_count; ++c)
+        {
+            if (cache[c] != tri[0] && cache[c] != tri[1] && cache[c] != tri[2])
+                new_cache[new_count++] = cache[c];
+        }
+
+        for (u32 c = 0; c < new_count; ++c)
+        {
+            const u32 v       = new_cache[c];
+            cache_position[v] = c < score_cache_size ? (i32) c : -1;
+            vertex_score[v]   = VertexScore(tables, cache_position[v], valence[v]);
+        }
+
+        // Only triangles touching the cache changed score, and the next one is picked from among them
+        best           = u32_invalid_id;
+        f32 best_score = -1.f;
+        for (u32 c = 0; c < new_count; ++c)
+        {
+            const u32* list = adjacency.data() + adjacency_offset[new_cache[c]];
+            for (u32 i = 0; i < valence[new_cache[c]]; ++i)
+            {
+                const u32 t       = list[i];
+                triangle_score[t] = score_triangle(t);
+                if (c < score_cache_size && triangle_score[t] > best_score)
+                {
+                    best       = t;
+                    best_score = triangle_score[t];
+                }
+            }
+        }
+
+        cache_count = math::Min(new_count, score_cache_size);
+        std::copy_n(new_cache, cache_count, cache);
+    }
+
+    indices.swap(ordered);
+}
+
+// Sum of squared distances to a set of planes, error(p) = p.A.p + 2 b.p + c with A symmetric
+struct Quadric
+{
+    f64 a00, a11, a22, a01, a02, a12;
+    f64 b0, b1, b2;
+    f64 c;
+
+    void AddPlane(const vec3& normal, f32 distance)
+    {
+        const f64 x = normal.x, y = normal.y, z = normal.z, d = distance;
+
+        a00 += x * x;
+        a11 += y * y;
+        a22 += z * z;
+        a01 += x * y;
+        a02 += x * z;
+        a12 += y * z;
+        b0  += x * d;
+        b1  += y * d;
+        b2  += z * d;
+        c   += d * d;
+    }
+
+    Quadric& operator+=(const Quadric& other)
+    {
+        a00 += other.a00;
+        a11 += other.a11;
+        a22 += other.a22;
+        a01 += other.a01;
+        a02 += other.a02;
+        a12 += other.a12;
+        b0  += other.b0;
+        b1  += other.b1;
+        b2  += other.b2;
+        c   += other.c;
+        return *this;
+    }
+
+    [[nodiscard]] f64 Error(const vec3& p) const
+    {
+        const f64 x = p.x, y = p.y, z = p.z;
+
+        const f64 error = a00 * x * x + a11 * y * y + a22 * z * z + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+                          2.0 * (b0 * x + b1 * y + b2 * z) + c;
+        return error > 0.0 ? error : 0.0;
+    }
+};
+
+// Triangles around each vertex, packed per vertex
+struct Adjacency
+{
+    utl::vector<u32> offsets;
+    utl::vector<u32> triangles;
+
+    void Build(const utl::vector<u32>& indices, u32 vertex_count)
+    {
+        offsets.assign(vertex_count + 1, 0);
+        for (u32 index : indices)
+        {
+            ++offsets[index + 1];
+        }
+        for (u32 v = 0; v < vertex_count; ++v)
+        {
+            offsets[v + 1] += offsets[v];
+        }
+
+        triangles.resize(indices.size());
+        utl::vector<u32> fill(offsets.begin(), offsets.end() - 1);
+        for (u32 i = 0; i < (u32) indices.size(); ++i)
+        {
+            triangles[fill[indices[i]]++] = i / 3;
+        }
+    }
+};
+
+// Half edge collapse of from onto to
+struct Collapse
+{
+    u32 from;
+    u32 to;
+    f32 error;
+};
+
+// Vertices that must stay put: ones on an open edge, which would pull the border in, and ones sharing their position
+// with another vertex (a normal or uv seam), which would tear the seam open
+utl::vector<u8> FindLockedVertices(const mesh_format::MeshSource& mesh)
+{
+    const u32       vertex_count = VertexCount(mesh);
+    utl::vector<u8> locked(vertex_count, 0);
+
+    // Sorting by position puts every seam's vertices next to each other
+    const auto position_bits = [&mesh](u32 v) {
+        u32 bits[3];
+        std::memcpy(bits, mesh.vertices.data() + (u64) v * mesh_format::floats_per_vertex, sizeof(bits));
+        return std::tuple{ bits[0], bits[1], bits[2] };
+    };
+
+    utl::vector<u32> by_position(vertex_count);
+    std::iota(by_position.begin(), by_position.end(), 0u);
+    std::sort(by_position.begin(), by_position.end(), [&](u32 a, u32 b) { return position_bits(a) < position_bits(b); });
+    for (u32 i = 1; i < vertex_count; ++i)
+    {
+        if (position_bits(by_position[i]) == position_bits(by_position[i - 1]))
+        {
+            locked[by_position[i]]     = 1;
+            locked[by_position[i - 1]] = 1;
+        }
+    }
+
+    // An edge is open when no triangle uses it in the other direction
+    std::unordered_set<u64> edges{};
+    edges.reserve(mesh.indices.size());
+    for (u64 i = 0; i < mesh.indices.size(); i += 3)
+    {
+        for (u32 k = 0; k < 3; ++k)
+        {
+            edges.insert((u64) mesh.indices[i + k] << 32 | mesh.indices[i + (k + 1) % 3]);
+        }
+    }
+    for (u64 i = 0; i < mesh.indices.size(); i += 3)
+    {
+        for (u32 k = 0; k < 3; ++k)
+        {
+            const u32 a = mesh.indices[i + k];
+            const u32 b = mesh.indices[i + (k + 1) % 3];
+            if (!edges.contains((u64) b << 32 | a))
+            {
+                locked[a] = 1;
+                locked[b] = 1;
+            }
+        }
+    }
+
+    return locked;
+}
+
+// Moving from onto to must not turn any of the triangles that keep their area over
+bool CollapseFlips(const utl::vector<u32>& indices, const Adjacency& adjacency, const utl::vector<vec3>& positions,
+                   const Collapse& collapse)
+{
+    for (u32 i = adjacency.offsets[collapse.from]; i < adjacency.offsets[collapse.from + 1]; ++i)
+    {
+        const u32* tri = indices.data() + (u64) adjacency.triangles[i] * 3;
+        if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to)
+            continue;
+
+        vec3 moved[3];
+        for (u32 k = 0; k < 3; ++k)
+        {
+            moved[k] = positions[tri[k] == collapse.from ? collapse.to : tri[k]];
+        }
+
+        const vec3 before = math::Cross(positions[tri[1]] - positions[tri[0]], positions[tri[2]] - positions[tri[0]]);
+        const vec3 after  = math::Cross(moved[1] - moved[0], moved[2] - moved[0]);
+        if (math::Dot(before, after) <= 0.f)
+            return true;
+    }
+
+    return false;
+}
+} // anonymous namespace
+
+CacheStats AnalyzeVertexCache(const u32* indices, u32 index_count, u32 vertex_count, u32 cache_size)
+{
+    if (index_count < 3 || vertex_count == 0)
+        return {};
+
+    FifoCache cache{ vertex_count, cache_size };
+    u32       misses = 0;
+    for (u32 i = 0; i < index_count; ++i)
+    {
+        misses += cache.Touch(indices[i]);
+    }
+
+    return { (f32) misses / (f32) (index_count / 3), (f32) misses / (f32) vertex_count };
+}
+
+u32 DeduplicateVertices(mesh_format::MeshSource& mesh)
+{
+    const u32 vertex_count = VertexCount(mesh);
+    u8*       data         = (u8*) mesh.vertices.data();
+
+    // Open addressing over the new vertex ids, kept at most half full. Unique vertices are compacted to the front as
+    // they're found, so a slot's id always points at data that has already been written
+    u32 table_size = 1;
+    while (table_size < vertex_count * 2)
+    {
+        table_size <<= 1;
+    }
+
+    utl::vector<u32> table(table_size, u32_invalid_id);
+    utl::vector<u32> remap(vertex_count);
+    u32              unique = 0;
+    for (u32 v = 0; v < vertex_count; ++v)
+    {
+        const u8* vertex = data + (u64) v * vertex_size;
+        u32       slot   = HashVertex(vertex) & (table_size - 1);
+        while (table[slot] != u32_invalid_id && std::memcmp(data + (u64) table[slot] * vertex_size, vertex, vertex_size) != 0)
+        {
+            slot = (slot + 1) & (table_size - 1);
+        }
+
+        if (table[slot] == u32_invalid_id)
+        {
+            std::memmove(data + (u64) unique * vertex_size, vertex, vertex_size);
+            table[slot] = unique++;
+        }
+        remap[v] = table[slot];
+    }
+
+    for (u32& index : mesh.indices)
+    {
+        index = remap[index];
+    }
+
+    mesh.vertices.resize((u64) unique * mesh_format::floats_per_vertex);
+    return vertex_count - unique;
+}
+
+void OptimizeVertexCache(mesh_format::MeshSource& mesh)
+{
+    CacheOrder(mesh.indices, VertexCount(mesh));
+}
+
+void OptimizeOverdraw(mesh_format::MeshSource& mesh, f32 threshold)
+{
+    const u32 vertex_count   = VertexCount(mesh);
+    const u32 triangle_count = (u32) (mesh.indices.size() / 3);
+    if (triangle_count < 2)
+        return;
+
+    const u32* indices = mesh.indices.data();
+    FifoCache  cache{ vertex_count, default_cache_size };
+
+    // A triangle missing on all three vertices starts a cluster the cache order already paid for
+    utl::vector<u32> hard{};
+    for (u32 t = 0; t < triangle_count; ++t)
+    {
+        if (cache.Triangle(indices + (u64) t * 3) == 3)
+            hard.emplace_back(t);
+    }
+    hard.emplace_back(triangle_count);
+
+    // Within those, a split resets the cache. It's taken as soon as the triangles since the last split are as cache
+    // efficient as the whole hard cluster was, within threshold
+    utl::vector<u32> clusters{};
+    for (u32 h = 0; h + 1 < hard.size(); ++h)
+    {
+        const u32 first = hard[h];
+        const u32 end   = hard[h + 1];
+
+        cache.Reset();
+        u32 misses = 0;
+        for (u32 t = first; t < end; ++t)
+        {
+            misses += cache.Triangle(indices + (u64) t * 3);
+        }
+        const f32 limit = (f32) misses / (f32) (end - first) * threshold;
+
+        cache.Reset();
+        clusters.emplace_back(first);
+        misses    = 0;
+        u32 start = first;
+        for (u32 t = first; t + 1 < end; ++t)
+        {
+            misses += cache.Triangle(indices + (u64) t * 3);
+            if ((f32) misses / (f32) (t + 1 - start) <= limit)
+            {
+                clusters.emplace_back(t + 1);
+                start  = t + 1;
+                misses = 0;
+                cache.Reset();
+            }
+        }
+    }
+    clusters.emplace_back(triangle_count);
+
+    const u32 cluster_count = (u32) clusters.size() - 1;
+    if (cluster_count < 2)
+        return;
+
+    // Area weighted centroid and summed normal of every cluster, and the centroid of the whole mesh
+    utl::vector<vec3> centroids(cluster_count);
+    utl::vector<vec3> normals(cluster_count);
+    vec3              mesh_centroid{};
+    f32               mesh_area = 0.f;
+    for (u32 c = 0; c < cluster_count; ++c)
+    {
+        vec3 centroid{};
+        vec3 normal{};
+        f32  area = 0.f;
+        for (u32 t = clusters[c]; t < clusters[c + 1]; ++t)
+        {
+            const vec3 a = Position(mesh, indices[t * 3]);
+            const vec3 b = Position(mesh, indices[t * 3 + 1]);
+            const vec3 d = Position(mesh, indices[t * 3 + 2]);
+
+            const vec3 face      = math::Cross(b - a, d - a);
+            const f32  face_area = face.Length();
+            centroid            += (a + b + d) * (face_area / 3.f);
+            normal              += face;
+            area                += face_area;
+        }
+
+        mesh_centroid += centroid;
+        mesh_area     += area;
+        centroids[c]   = area > 0.f ? centroid * (1.f / area) : Position(mesh, indices[clusters[c] * 3]);
+        normals[c]     = normal;
+    }
+    if (mesh_area > 0.f)
+    {
+        mesh_centroid = mesh_centroid * (1.f / mesh_area);
+    }
+
+    // Clusters facing away from the middle of the mesh are on its outside and likely to occlude the rest
+    utl::vector<f32> sort_key(cluster_count);
+    utl::vector<u32> order(cluster_count);
+    for (u32 c = 0; c < cluster_count; ++c)
+    {
+        const f32 length = normals[c].Length();
+        sort_key[c]      = length > 0.f ? math::Dot(centroids[c] - mesh_centroid, normals[c]) / length : 0.f;
+        order[c]         = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](u32 a, u32 b) { return sort_key[a] > sort_key[b]; });
+
+    utl::vector<u32> sorted{};
+    sorted.reserve(mesh.indices.size());
+    for (u32 c : order)
+    {
+        sorted.insert(sorted.end(), indices + (u64) clusters[c] * 3, indices + (u64) clusters[c + 1] * 3);
+    }
+
+    mesh.indices.swap(sorted);
+}
+
+void OptimizeVertexFetch(mesh_format::MeshSource& mesh)
+{
+    const u32 vertex_count = VertexCount(mesh);
+
+    utl::vector<u32> remap(vertex_count, u32_invalid_id);
+    utl::vector<f32> vertices(mesh.vertices.size());
+    u32              next = 0;
+    for (u32& index : mesh.indices)
+    {
+        if (remap[index] == u32_invalid_id)
+        {
+            std::memcpy(vertices.data() + (u64) next * mesh_format::floats_per_vertex,
+                        mesh.vertices.data() + (u64) index * mesh_format::floats_per_vertex, vertex_size);
+            remap[index] = next++;
+        }
+        index = remap[index];
+    }
+
+    vertices.resize((u64) next * mesh_format::floats_per_vertex);
+    mesh.vertices.swap(vertices);
+}
+
+f32 Simplify(const mesh_format::MeshSource& mesh, u32 target_index_count, f32 max_error, utl::vector<u32>& out)
+{
+    const u32 vertex_count = VertexCount(mesh);
+    out                    = mesh.indices;
+    if (out.size() <= target_index_count)
+        return 0.f;
+
+    // Errors come out as a fraction of the radius
+    const f32         scale = mesh.radius > 0.f ? 1.f / mesh.radius : 1.f;
+    utl::vector<vec3> positions(vertex_count);
+    for (u32 v = 0; v < vertex_count; ++v)
+    {
+        positions[v] = Position(mesh, v) * scale;
+    }
+
+    utl::vector<Quadric> quadrics(vertex_count, Quadric{});
+    for (u64 i = 0; i < out.size(); i += 3)
+    {
+        const vec3& a      = positions[out[i]];
+        const vec3  normal = math::Cross(positions[out[i + 1]] - a, positions[out[i + 2]] - a);
+        const f32   length = normal.Length();
+        if (length <= 0.f)
+            continue;
+
+        const vec3 unit = normal * (1.f / length);
+        for (u32 k = 0; k < 3; ++k)
+        {
+            quadrics[out[i + k]].AddPlane(unit, -math::Dot(unit, a));
+        }
+    }
+
+    const utl::vector<u8> locked = FindLockedVertices(mesh);
+    const f64             limit  = (f64) max_error * max_error;
+
+    Adjacency             adjacency{};
+    utl::vector<Collapse> collapses{};
+    utl::vector<u32>      remap(vertex_count);
+    utl::vector<u8>       touched(vertex_count);
+    f32                   result_error = 0.f;
+
+    // Each pass collapses the cheapest edges whose neighbourhoods don't overlap, then rebuilds the triangles
+    while (out.size() > target_index_count)
+    {
+        adjacency.Build(out, vertex_count);
+
+        collapses.clear();
+        for (u64 i = 0; i < out.size(); i += 3)
+        {
+            for (u32 k = 0; k < 3; ++k)
+            {
+                const u32 a = out[i + k];
+                const u32 b = out[i + (k + 1) % 3];
+                if (a >= b)
+                    continue;
+
+                Quadric sum = quadrics[a];
+                sum        += quadrics[b];
+
+                const f64 a_to_b = locked[a] ? limit + 1.0 : sum.Error(positions[b]);
+                const f64 b_to_a = locked[b] ? limit + 1.0 : sum.Error(positions[a]);
+                if (math::Min(a_to_b, b_to_a) > limit)
+                    continue;
+
+                collapses.emplace_back(a_to_b <= b_to_a ? Collapse{ a, b, (f32) a_to_b } : Collapse{ b, a, (f32) b_to_a });
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& x, const Collapse& y) { return x.error < y.error; });
+
+        std::iota(remap.begin(), remap.end(), 0u);
+        std::fill(touched.begin(), touched.end(), (u8) 0);
+
+        u32       triangles_left = (u32) (out.size() / 3);
+        const u32 target         = target_index_count / 3;
+        u32       collapsed      = 0;
+        for (const Collapse& collapse : collapses)
+        {
+            if (triangles_left <= target)
+                break;
+            if (touched[collapse.from] || touched[collapse.to] || CollapseFlips(out, adjacency, positions, collapse))
+                continue;
+
+            remap[collapse.from]      = collapse.to;
+            quadrics[collapse.to]    += quadrics[collapse.from];
+            result_error              = math::Max(result_error, collapse.error);
+            ++collapsed;
+
+            // Later collapses this pass see stale triangles around from, so its whole ring sits the pass out
+            for (u32 i = adjacency.offsets[collapse.from]; i < adjacency.offsets[collapse.from + 1]; ++i)
+            {
+                const u32* tri = out.data() + (u64) adjacency.triangles[i] * 3;
+                touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+                if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to)
+                    --triangles_left;
+            }
+        }
+
+        if (collapsed == 0)
+            break;
+
+        u64 write = 0;
+        for (u64 i = 0; i < out.size(); i += 3)
+        {
+            const u32 a = remap[out[i]];
+            const u32 b = remap[out[i + 1]];
+            const u32 c = remap[out[i + 2]];
+            if (a == b || b == c || a == c)
+                continue;
+
+            out[write++] = a;
+            out[write++] = b;
+            out[write++] = c;
+        }
+        out.resize(write);
+    }
+
+    return std::sqrt(result_error);
+}
+
+void GenerateLods(mesh_format::MeshSource& mesh)
+{
+    PROFILE_SCOPE("Generate mesh LODs");
+    mesh.lods.clear();
+
+    const u32 vertex_count = VertexCount(mesh);
+    u64       previous     = mesh.indices.size();
+    for (u32 level = 1; level < mesh_format::max_lods; ++level)
+    {
+        const u32 target = (u32) (mesh.indices.size() / 3 >> level) * 3;
+
+        mesh_format::MeshLod lod{};
+        lod.error = Simplify(mesh, target, lod_max_error, lod.indices);
+
+        // Not worth a level, the simplifier ran into locked vertices or the error limit
+        if (lod.indices.empty() || lod.indices.size() * 5 > previous * 4)
+            break;
+
+        CacheOrder(lod.indices, vertex_count);
+        previous = lod.indices.size();
+        mesh.lods.emplace_back(std::move(lod));
+    }
+}
+
+OptimizeStats Optimize(mesh_format::MeshSource& mesh)
+{
+    PROFILE_SCOPE("Optimize mesh");
+    // The passes renumber vertices, LODs are rebuilt against the result
+    mesh.lods.clear();
+
+    OptimizeStats stats{};
+    stats.vertices_before = VertexCount(mesh);
+    stats.before          = AnalyzeVertexCache(mesh.indices.data(), (u32) mesh.indices.size(), stats.vertices_before);
+
+    DeduplicateVertices(mesh);
+    OptimizeVertexCache(mesh);
+    OptimizeOverdraw(mesh);
+    OptimizeVertexFetch(mesh);
+    GenerateLods(mesh);
+
+    stats.vertices_after = VertexCount(mesh);
+    stats.after          = AnalyzeVertexCache(mesh.indices.data(), (u32) mesh.indices.size(), stats.vertices_after);
+    stats.lod_count      = (u32) mesh.lods.size();
+    return stats;
+}
+
+} // namespace retract::mesh_optimizer
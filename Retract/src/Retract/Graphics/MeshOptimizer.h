@@ -0,0 +1,78 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MeshOptimizer.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "MeshFormat.h"
+
+// Load time cleanup of a mesh's index order. Exporters write triangles in whatever order they were modeled, which
+// wastes the post-transform vertex cache and scatters vertex fetches across the buffer. Runs on MeshSource, in the
+// converter and when a .gpmesh is loaded directly
+namespace retract::mesh_optimizer
+{
+
+// Size of the simulated FIFO post-transform cache the stats are measured against
+constexpr u32 default_cache_size = 16;
+// How much worse than its Forsyth order a cluster's cache efficiency may get before overdraw sorting stops splitting it
+constexpr f32 default_overdraw_threshold = 1.05f;
+// Simplification stops once a collapse would move the surface further than this, as a fraction of the mesh's radius
+constexpr f32 lod_max_error = 0.1f;
+
+struct CacheStats
+{
+    f32 acmr{}; // vertices transformed per triangle, 0.5 is perfect on a large grid and 3 the worst
+    f32 atvr{}; // vertices transformed per vertex, 1 is perfect
+};
+
+struct OptimizeStats
+{
+    u32        vertices_before{};
+    u32        vertices_after{};
+    CacheStats before{};
+    CacheStats after{};
+    u32        lod_count{};
+};
+
+CacheStats AnalyzeVertexCache(const u32* indices, u32 index_count, u32 vertex_count, u32 cache_size = default_cache_size);
+
+// Merges vertices whose attributes are bitwise identical, returns how many were removed
+u32 DeduplicateVertices(mesh_format::MeshSource& mesh);
+// Tom Forsyth's linear-speed vertex cache optimisation, reorders triangles only
+void OptimizeVertexCache(mesh_format::MeshSource& mesh);
+// Splits the cache ordered triangles into clusters and draws the outward facing ones first, so the rest of the mesh
+// fails the depth test more often. Run after OptimizeVertexCache, threshold bounds the cache efficiency given up
+void OptimizeOverdraw(mesh_format::MeshSource& mesh, f32 threshold = default_overdraw_threshold);
+// Renumbers vertices in the order the indices first reference them and drops unreferenced ones
+void OptimizeVertexFetch(mesh_format::MeshSource& mesh);
+
+// Quadric error edge collapse down to target_index_count, writing the coarser triangles into out. Collapses keep one of
+// the edge's vertices, so out indexes the mesh's own vertices. Returns the largest error taken, relative to the radius
+f32 Simplify(const mesh_format::MeshSource& mesh, u32 target_index_count, f32 max_error, utl::vector<u32>& out);
+// Fills mesh.lods with up to max_lods - 1 levels, each roughly half the triangles of the one before
+void GenerateLods(mesh_format::MeshSource& mesh);
+
+// All of the above in order
+OptimizeStats Optimize(mesh_format::MeshSource& mesh);
+
+} // namespace retract::mesh_optimizer
@@ -0,0 +1,92 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: RenderQueue.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "RenderQueue.h"
+
+#include <algorithm>
+
+namespace retract::graphics
+{
+
+namespace draw_key
+{
+u32 Depth(f32 distance, f32 far)
+{
+    constexpr u32 max_depth = (1u << depth_bits) - 1;
+    return (u32) (math::Clamp(distance / far, 0.f, 1.f) * (f32) max_depth);
+}
+} // namespace draw_key
+
+void RenderQueue::Sort()
+{
+    PROFILE_FUNCTION();
+    constexpr u32 radix_passes = sizeof(u64);
+    const u32     count        = Size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    // Every byte's histogram in one read over the keys
+    u32 histograms[radix_passes][256]{};
+    for (const Item& item : mItems)
+    {
+        for (u32 pass = 0; pass < radix_passes; ++pass)
+        {
+            ++histograms[pass][(item.key >> (pass * 8)) & 0xff];
+        }
+    }
+
+    mScratch.resize(count);
+    for (u32 pass = 0; pass < radix_passes; ++pass)
+    {
+        u32* histogram = histograms[pass];
+        if (std::ranges::any_of(histogram, histogram + 256, [count](u32 n) { return n == count; }))
+        {
+            continue;
+        }
+
+        u32 offset = 0;
+        for (u32 i = 0; i < 256; ++i)
+        {
+            const u32 n  = histogram[i];
+            histogram[i] = offset;
+            offset      += n;
+        }
+
+        const u32 shift = pass * 8;
+        for (const Item& item : mItems)
+        {
+            mScratch[histogram[(item.key >> shift) & 0xff]++] = item;
+        }
+        mItems.swap(mScratch);
+    }
+}
+
+u32 RenderQueue::First(draw_key::Pass pass) const
+{
+    const auto it = std::ranges::lower_bound(mItems, pass, {}, [](const Item& item) { return draw_key::GetPass(item.key); });
+    return (u32) (it - mItems.begin());
+}
+
+} // namespace retract::graphics
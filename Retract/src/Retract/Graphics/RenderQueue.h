@@ -0,0 +1,111 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: RenderQueue.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Common.h"
+
+namespace retract::graphics
+{
+
+// 64 bit sort keys, most significant field first. Sorting the keys groups draws by program, then texture, then
+// mesh and LOD, so consecutive draws share as much GL state as possible. Fields hold GL object names and mesh ids cut
+// to their width, two objects landing on the same bits only costs a rebind since the draw loops compare the actual
+// objects
+namespace draw_key
+{
+enum class Pass : u8
+{
+    opaque,
+    sprite,
+};
+
+constexpr u32 pass_bits    = 4;
+constexpr u32 shader_bits  = 8;
+constexpr u32 texture_bits = 16;
+constexpr u32 mesh_bits    = 14;
+constexpr u32 lod_bits     = 2;
+constexpr u32 depth_bits   = 20;
+static_assert(pass_bits + shader_bits + texture_bits + mesh_bits + lod_bits + depth_bits == 64);
+
+constexpr u64 Field(u64 value, u32 bits, u32 shift)
+{
+    return (value & ((1ull << bits) - 1)) << shift;
+}
+
+// pass | shader | texture | mesh | lod | depth, depth last so draws sharing all state go front to back.
+// mesh is the mesh_buffer id of the mesh
+constexpr u64 Mesh(u32 shader, u32 texture, u32 mesh, u32 lod, u32 depth)
+{
+    return Field((u64) Pass::opaque, pass_bits, 60) | Field(shader, shader_bits, 52) | Field(texture, texture_bits, 36) |
+           Field(mesh, mesh_bits, 22) | Field(lod, lod_bits, 20) | Field(depth, depth_bits, 0);
+}
+
+// pass | draw order | shader | texture. Draw order has to win over state for blending to layer correctly,
+// the sort is stable so equal keys stay in submission order
+constexpr u64 Sprite(i32 draw_order, u32 shader, u32 texture)
+{
+    const u32 order = (u32) (math::Clamp(draw_order, -0x8000, 0x7fff) + 0x8000);
+    return Field((u64) Pass::sprite, pass_bits, 60) | Field(order, 16, 44) | Field(shader, shader_bits, 36) |
+           Field(texture, texture_bits, 20);
+}
+
+constexpr Pass GetPass(u64 key)
+{
+    return (Pass) (key >> 60);
+}
+
+// Distance quantized to depth_bits, 0 at the camera and all ones at far and beyond
+u32 Depth(f32 distance, f32 far);
+} // namespace draw_key
+
+// Draws submitted as (key, index) pairs and radix sorted once a frame
+class RenderQueue
+{
+public:
+    struct Item
+    {
+        u64 key;
+        u32 index;
+    };
+
+    void Clear() { mItems.clear(); }
+    void Submit(u64 key, u32 index) { mItems.emplace_back(Item{ key, index }); }
+
+    // Stable LSD radix sort, a byte per pass. Bytes every key agrees on are skipped, which with few
+    // shaders and textures in the scene leaves only a handful of passes
+    void Sort();
+
+    // First item at or after pass, the items for a pass run from here up to the next pass' first item
+    [[nodiscard]] u32 First(draw_key::Pass pass) const;
+
+    [[nodiscard]] constexpr u32         Size() const { return (u32) mItems.size(); }
+    [[nodiscard]] constexpr const Item& operator[](u32 i) const { return mItems[i]; }
+
+private:
+    utl::vector<Item> mItems{};
+    utl::vector<Item> mScratch{};
+};
+
+} // namespace retract::graphics
@@ -22,139 +22,475 @@
 //  ------------------------------------------------------------------------------
 
 #include "Renderer.h"
-
-
-#include "VertexArray.h"
+#include "Frustum.h"
+#include "GLState.h"
+#include "GpuProfiler.h"
+#include "RenderQueue.h"
+#include "SpriteBatch.h"
+#include "MeshBuffer.h"
+#include "Retract/Components/Entity.h"
+#include "Retract/Components/Systems.h"
+#include "Retract/Core/Jobs.h"
 #include "Retract/Core/Resources.h"
 #include "Retract/Core/Window.h"
 
+#include <numeric>
+
 namespace retract::graphics
 {
 
 namespace
 {
-std::vector<Sprite*>        sprites{};
-std::vector<MeshComponent*> meshes{};
-
 Shader*      sprite_shader{};
 Shader*      mesh_shader{};
-VertexArray* sprite_verts{};
+SpriteBatch* sprite_batch{};
+
+// Every draw of the frame, meshes first then sprites, see draw_key for the layout
+RenderQueue render_queue{};
+
+// Indices into the sprite pool in the order the queue sorted them
+utl::vector<u32> sprite_order{};
+constexpr u32    sprite_batch_size = 512;
+
+// Mirror the std430 blocks in PhongInstanced.vert. Matrices are row_major there as in FrameData
+struct InstanceData
+{
+    mat4 world;
+    u32  material;
+    u32  padding[3];
+};
+static_assert(sizeof(InstanceData) == 80);
+
+// x of the vec4 in MaterialData, the rest is free for later material parameters
+struct MaterialData
+{
+    f32 specular_power;
+    f32 padding[3];
+};
+static_assert(sizeof(MaterialData) == 16);
+
+// Laid out as GL's DrawElementsIndirectCommand
+struct DrawCommand
+{
+    u32 count;
+    u32 instance_count;
+    u32 first_index;
+    i32 base_vertex;
+    u32 base_instance;
+};
+
+// Meshes sharing a mesh, LOD and texture are one indirect draw, their per instance data
+// sits next to each other in instance_data_buffer starting at first
+struct MeshInstanceGroup
+{
+    Mesh*    mesh{};
+    u32      lod{};
+    Texture* texture{};
+    u32      first{};
+    u32      count{};
+};
+
+utl::vector<u32>               mesh_draw_order{};
+utl::vector<InstanceData>      mesh_instances{};
+utl::vector<MeshInstanceGroup> mesh_groups{};
+utl::vector<MaterialData>      mesh_materials{};
+utl::vector<DrawCommand>       mesh_commands{};
+constexpr u32                  instance_batch_size = 512;
+
+// Rewritten every frame, sizes are the capacity reached so far
+u32 instance_data_buffer{};
+u32 instance_data_size{};
+u32 material_buffer{};
+u32 material_size{};
+u32 indirect_buffer{};
+u32 indirect_size{};
+
+// Holds 0, 1, 2, ... read as a per instance attribute. Instanced attributes start counting at the draw's base
+// instance, which is how each draw of a multi draw finds its entries in InstanceData (gl_BaseInstance is GL 4.6)
+u32 draw_id_buffer{};
+u32 draw_id_count{};
+
+// Loaded meshes up for culling and their world space bounding spheres, kept as separate arrays for the SSE test
+utl::vector<u32> cull_candidates{};
+utl::vector<f32> cull_x{};
+utl::vector<f32> cull_y{};
+utl::vector<f32> cull_z{};
+utl::vector<f32> cull_radius{};
+utl::vector<f32> cull_scale{};
+utl::vector<u8>  cull_visible{};
+constexpr u32    cull_batch_size = 1024;
+CullStats        cull_stats{};
+
+constexpr f32 camera_near = 25.f;
+constexpr f32 camera_far  = 10000.f;
+
+// A mesh steps down to a coarser LOD once that level's error covers less than lod_pixel_error pixels on screen. The
+// hysteresis band around the threshold keeps meshes sitting right at it from popping between levels every frame
+constexpr f32 lod_pixel_error = 1.f;
+constexpr f32 lod_hysteresis  = 0.25f;
+static_assert(mesh_format::max_lods <= 1u << draw_key::lod_bits);
 
 mat4 view{};
 mat4 projection{};
+mat4 sprite_view_proj{};
+vec3 camera_pos{};
 
 vec3             ambient_light{};
 DirectionalLight directional_light{};
 
-void CreateSpriteVerts()
+// Mirrors the std140 FrameData block in the shaders, vec3s take up a full vec4 slot.
+// Matrices are declared row_major in GLSL so they go up without transposing
+struct FrameData
 {
-    const std::vector<f32> vertices{
-        -0.5f, 0.5f,  0.f, 0.f, 0.f, 0.f, 0.f, 0.f, // top left
-        0.5f,  0.5f,  0.f, 0.f, 0.f, 0.f, 1.f, 0.f, // top right
-        0.5f,  -0.5f, 0.f, 0.f, 0.f, 0.f, 1.f, 1.f, // bottom right
-        -0.5f, -0.5f, 0.f, 0.f, 0.f, 0.f, 0.f, 1.f  // bottom left
-    };
+    mat4 view_proj;
+    mat4 sprite_view_proj;
+    vec4 camera_pos;
+    vec4 ambient_light;
+    vec4 light_direction;
+    vec4 light_diffuse;
+    vec4 light_specular;
+};
+static_assert(sizeof(FrameData) == 208);
+
+u32 frame_data_buffer{};
+
+vec4 Std140(const vec3& v)
+{
+    return { v.x, v.y, v.z, 0.f };
+}
 
-    const std::vector<u32> indices{ 0, 1, 2, 2, 3, 0 };
+void UploadFrameData(const mat4& view_proj)
+{
+    const FrameData data{
+        .view_proj        = view_proj,
+        .sprite_view_proj = sprite_view_proj,
+        .camera_pos       = Std140(camera_pos),
+        .ambient_light    = Std140(ambient_light),
+        .light_direction  = Std140(directional_light.direction),
+        .light_diffuse    = Std140(directional_light.diffuseColor),
+        .light_specular   = Std140(directional_light.specularColor),
+    };
 
-    sprite_verts = DBG_NEW VertexArray(vertices, 4, indices);
+    glNamedBufferSubData(frame_data_buffer, 0, sizeof(FrameData), &data);
 }
 
 bool LoadShaders()
 {
-    sprite_shader = core::LoadShader("Sprite", "./Shaders/Sprite.vert", "./Shaders/Sprite.frag");
+    sprite_shader = core::LoadShader("Sprite", "./Shaders/SpriteBatch.vert", "./Shaders/Sprite.frag");
     if (!sprite_shader)
     {
         return false;
     }
 
-    sprite_shader->Activate();
-
-    const mat4 viewProj = math::SimpleViewProjection((f32) window::Width(), (f32) window::Height());
-    sprite_shader->SetMatrix("ViewProj", viewProj);
-
-    mesh_shader = core::LoadShader("Mesh", "./Shaders/Phong.vert", "./Shaders/Phong.frag");
+    mesh_shader = core::LoadShader("Mesh", "./Shaders/PhongInstanced.vert", "./Shaders/Phong.frag");
     if (!mesh_shader)
     {
         return false;
     }
-    mesh_shader->Activate();
-    view       = math::LookAt(math::zero_vec3, math::unitx_vec3, math::unitz_vec3);
-    projection = math::Perspective(math::ToRadians(70.f), (f32) window::Width(), (f32) window::Height(), 25.f, 10000.f);
-    mesh_shader->SetMatrix("ViewProj", view * projection);
+
+    sprite_view_proj = math::SimpleViewProjection((f32) window::Width(), (f32) window::Height());
+    projection       = math::Perspective(math::ToRadians(70.f), (f32) window::Width(), (f32) window::Height(), camera_near,
+                                         camera_far);
+    SetViewMatrix(math::LookAt(math::zero_vec3, math::unitx_vec3, math::unitz_vec3));
+
+    glCreateBuffers(1, &frame_data_buffer);
+    glNamedBufferData(frame_data_buffer, sizeof(FrameData), nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, frame_data_binding, frame_data_buffer);
 
     return true;
 }
 
-void SetLightUniforms(const Shader* shader)
+// Moves each candidate's model space sphere into world space. The radius grows with the largest axis scale
+void ComputeCullSpheres(const ecs::MeshData* meshes, u32 begin, u32 end)
+{
+    for (u32 i = begin; i < end; ++i)
+    {
+        const ecs::MeshData& data   = meshes[cull_candidates[i]];
+        const mat4&          world  = data.owner->RenderTransform();
+        const vec3           center = math::Transform(data.mesh->SphereCenter(), world);
+
+        const f32 scale_sq = math::Max(math::Max(vec3{ world.mat[0][0], world.mat[0][1], world.mat[0][2] }.LengthSq(),
+                                                 vec3{ world.mat[1][0], world.mat[1][1], world.mat[1][2] }.LengthSq()),
+                                       vec3{ world.mat[2][0], world.mat[2][1], world.mat[2][2] }.LengthSq());
+
+        cull_x[i]      = center.x;
+        cull_y[i]      = center.y;
+        cull_z[i]      = center.z;
+        cull_scale[i]  = math::Sqrt(scale_sq);
+        cull_radius[i] = data.mesh->SphereRadius() * cull_scale[i];
+    }
+}
+
+// Starts from the level drawn last frame and only leaves it once its error is outside the hysteresis band.
+// screen_radius is the mesh's Radius() in pixels
+u32 SelectLod(const Mesh& mesh, u32 current, f32 screen_radius)
 {
-    mat4 invView = view;
-    invView.Invert();
+    const u32 lod_count = mesh.LodCount();
+    u32       lod       = math::Min(current, lod_count - 1);
 
-    shader->SetVector("CameraPos", invView.Translation());
-    shader->SetVector("AmbientLight", ambient_light);
+    while (lod > 0 && mesh.LodError(lod) * screen_radius > lod_pixel_error * (1.f + lod_hysteresis))
+    {
+        --lod;
+    }
+    while (lod + 1 < lod_count && mesh.LodError(lod + 1) * screen_radius < lod_pixel_error * (1.f - lod_hysteresis))
+    {
+        ++lod;
+    }
 
-    shader->SetVector("DirLight.direction", directional_light.direction);
-    shader->SetVector("DirLight.diffuseColor", directional_light.diffuseColor);
-    shader->SetVector("DirLight.specularColor", directional_light.specularColor);
+    return lod;
 }
 
-} // anonymous namespace
+// Submits the loaded meshes that touch the frustum to the render queue at their LOD, keyed by state and camera distance
+void CullMeshes(const Frustum& frustum)
+{
+    PROFILE_FUNCTION();
+    ecs::MeshData* meshes = ecs::MeshPool().Data();
+    const u32      count  = ecs::MeshPool().Size();
 
-bool Initialize()
+    cull_candidates.clear();
+    for (u32 i = 0; i < count; ++i)
+    {
+        if (meshes[i].mesh && meshes[i].mesh->IsLoaded())
+            cull_candidates.emplace_back(i);
+    }
+
+    const u32 candidate_count = (u32) cull_candidates.size();
+    cull_x.resize(candidate_count);
+    cull_y.resize(candidate_count);
+    cull_z.resize(candidate_count);
+    cull_radius.resize(candidate_count);
+    cull_scale.resize(candidate_count);
+    cull_visible.resize(candidate_count);
+
+    // Batches are a multiple of four so only the very last one has a scalar tail
+    jobs::ParallelFor(candidate_count, cull_batch_size, [meshes, &frustum](u32 begin, u32 end) {
+        ComputeCullSpheres(meshes, begin, end);
+        frustum.CullSpheres(cull_x.data() + begin, cull_y.data() + begin, cull_z.data() + begin, cull_radius.data() + begin,
+                            end - begin, cull_visible.data() + begin);
+    });
+
+    // Pixels covered by one world unit at distance one, yScale of the projection is cot(fov / 2)
+    const f32 pixels_per_unit = projection.mat[1][1] * ScreenHeight() * 0.5f;
+
+    const u32 shader     = mesh_shader->Id();
+    u32       drawn      = 0;
+    u32       simplified = 0;
+    for (u32 i = 0; i < candidate_count; ++i)
+    {
+        if (!cull_visible[i])
+            continue;
+
+        ecs::MeshData& data     = meshes[cull_candidates[i]];
+        const Texture* texture  = data.mesh->GetTexture(data.texture_index);
+        const f32      distance = (vec3{ cull_x[i], cull_y[i], cull_z[i] } - camera_pos).Length();
+
+        const f32 screen_radius = data.mesh->Radius() * cull_scale[i] * pixels_per_unit / math::Max(distance, camera_near);
+        data.lod                = SelectLod(*data.mesh, data.lod, screen_radius);
+
+        const u64 key = draw_key::Mesh(shader, texture ? texture->Id() : 0, data.mesh->GetRange().mesh_id, data.lod,
+                                       draw_key::Depth(distance, camera_far));
+        render_queue.Submit(key, cull_candidates[i]);
+        ++drawn;
+        simplified += data.lod > 0 ? 1 : 0;
+    }
+
+    cull_stats.tested     = candidate_count;
+    cull_stats.drawn      = drawn;
+    cull_stats.culled     = cull_stats.tested - cull_stats.drawn;
+    cull_stats.simplified = simplified;
+}
+
+// Orphans the old storage so the driver doesn't stall on last frame's draws
+void UploadStream(u32 buffer, u32& capacity, u32 size, const void* data)
 {
-    if (!LoadShaders())
+    capacity = math::Max(capacity, size);
+    glNamedBufferData(buffer, capacity, nullptr, GL_STREAM_DRAW);
+    glNamedBufferSubData(buffer, 0, size, data);
+}
+
+void ReserveDrawIds(u32 count)
+{
+    if (count <= draw_id_count)
+        return;
+
+    draw_id_count = math::Max(count, draw_id_count * 2);
+    utl::vector<u32> ids(draw_id_count);
+    std::iota(ids.begin(), ids.end(), 0u);
+    glNamedBufferData(draw_id_buffer, draw_id_count * (u32) sizeof(u32), ids.data(), GL_STATIC_DRAW);
+}
+
+// Gathers the per instance data of the queued meshes in [begin, end) in key order, with one indirect command and
+// material per group, and uploads it all in one go. Groups are split on the actual mesh, LOD and texture, keys only
+// bring them together
+void BuildMeshInstances(u32 begin, u32 end)
+{
+    const ecs::MeshData* meshes = ecs::MeshPool().Data();
+
+    mesh_draw_order.clear();
+    for (u32 i = begin; i < end; ++i)
     {
-        LOG_ERROR("Failed to load shaders");
-        return false;
+        mesh_draw_order.emplace_back(render_queue[i].index);
     }
-    CreateSpriteVerts();
 
-    return true;
+    const u32 instance_count = (u32) mesh_draw_order.size();
+    mesh_instances.resize(instance_count);
+    jobs::ParallelFor(instance_count, instance_batch_size, [meshes](u32 begin, u32 end) {
+        for (u32 i = begin; i < end; ++i)
+        {
+            mesh_instances[i].world = meshes[mesh_draw_order[i]].owner->RenderTransform();
+        }
+    });
+
+    mesh_groups.clear();
+    for (u32 i = 0; i < instance_count; ++i)
+    {
+        const ecs::MeshData& data    = meshes[mesh_draw_order[i]];
+        Texture*             texture = data.mesh->GetTexture(data.texture_index);
+        if (mesh_groups.empty() || mesh_groups.back().mesh != data.mesh || mesh_groups.back().lod != data.lod ||
+            mesh_groups.back().texture != texture)
+        {
+            mesh_groups.emplace_back(MeshInstanceGroup{ data.mesh, data.lod, texture, i, 0 });
+        }
+        ++mesh_groups.back().count;
+        mesh_instances[i].material = (u32) mesh_groups.size() - 1;
+    }
+
+    mesh_materials.clear();
+    mesh_commands.clear();
+    for (const MeshInstanceGroup& group : mesh_groups)
+    {
+        const mesh_buffer::Range& range = group.mesh->GetRange(group.lod);
+        mesh_materials.emplace_back(MaterialData{ group.mesh->SpecularPower() });
+        mesh_commands.emplace_back(
+            DrawCommand{ range.index_count, group.count, range.first_index, (i32) range.base_vertex, group.first });
+    }
+
+    ReserveDrawIds(instance_count);
+    UploadStream(instance_data_buffer, instance_data_size, instance_count * (u32) sizeof(InstanceData), mesh_instances.data());
+    UploadStream(material_buffer, material_size, (u32) (mesh_materials.size() * sizeof(MaterialData)), mesh_materials.data());
+    UploadStream(indirect_buffer, indirect_size, (u32) (mesh_commands.size() * sizeof(DrawCommand)), mesh_commands.data());
+
+    // Re-specifying the storage leaves the bindings in place, but they need a store to bind the first time
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, instance_data_binding, instance_data_buffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, material_data_binding, material_buffer);
 }
 
-void Shutdown()
+// Every group goes out through glMultiDrawElementsIndirect, one call per run of groups sharing a texture, vertex format
+// and index type. Those are the only state left that differs between meshes
+void DrawMeshGroups()
 {
-    delete sprite_verts;
-    core::UnloadTextures();
-    core::UnloadShaders();
-    core::UnloadMeshes();
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect_buffer);
+
+    const u32 group_count = (u32) mesh_groups.size();
+    for (u32 first = 0, last = 0; first < group_count; first = last)
+    {
+        const MeshInstanceGroup&  group = mesh_groups[first];
+        const mesh_buffer::Range& range = group.mesh->GetRange();
+        for (last = first + 1; last < group_count; ++last)
+        {
+            const mesh_buffer::Range& next = mesh_groups[last].mesh->GetRange();
+            if (mesh_groups[last].texture != group.texture || next.format != range.format || next.index_type != range.index_type)
+                break;
+        }
+
+        if (group.texture)
+        {
+            group.texture->Activate();
+        }
+
+        mesh_buffer::Activate(range.format, range.index_type, draw_id_buffer);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, mesh_buffer::IndexGLType(range.index_type),
+                                    (const void*) ((u64) first * sizeof(DrawCommand)), (i32) (last - first), 0);
+    }
 }
 
-void AddSprite(Sprite* sprite)
+// Sprites go in after the meshes, keyed by draw order first so blending layers them correctly
+void SubmitSprites()
 {
-    const i32 drawOrder = sprite->DrawOrder();
-    auto      it        = sprites.begin();
-    while (it != sprites.end())
+    const ecs::SpriteData* sprites = ecs::SpritePool().Data();
+    const u32              count   = ecs::SpritePool().Size();
+    const u32              shader  = sprite_shader->Id();
+
+    for (u32 i = 0; i < count; ++i)
     {
-        if (drawOrder < (*it)->DrawOrder())
-            break;
-        ++it;
+        const Texture* texture = sprites[i].texture;
+        render_queue.Submit(draw_key::Sprite(sprites[i].draw_order, shader, texture ? texture->Id() : 0), i);
     }
+}
 
-    sprites.insert(it, sprite);
+void WriteQuadVertex(SpriteBatch::Vertex& vertex, const mat4& world, f32 x, f32 y, f32 u, f32 v)
+{
+    vertex.x = x * world.mat[0][0] + y * world.mat[1][0] + world.mat[3][0];
+    vertex.y = x * world.mat[0][1] + y * world.mat[1][1] + world.mat[3][1];
+    vertex.u = u;
+    vertex.v = v;
 }
 
-void RemoveSprite(Sprite* sprite)
+// Transforms the corners of every sprite on the job workers, straight into the mapped buffer
+void WriteSpriteQuads(SpriteBatch::Vertex* vertices)
 {
-    const auto it = std::ranges::find(sprites, sprite);
-    sprites.erase(it);
+    const ecs::SpriteData* sprites = ecs::SpritePool().Data();
+    jobs::ParallelFor((u32) sprite_order.size(), sprite_batch_size, [sprites, vertices](u32 begin, u32 end) {
+        for (u32 i = begin; i < end; ++i)
+        {
+            const ecs::SpriteData& data  = sprites[sprite_order[i]];
+            const mat4&            world = data.owner->RenderTransform();
+            const f32              w     = data.texture ? 0.5f * (f32) data.texture->Width() : 0.f;
+            const f32              h     = data.texture ? 0.5f * (f32) data.texture->Height() : 0.f;
+
+            SpriteBatch::Vertex* quad = vertices + i * SpriteBatch::vertices_per_quad;
+            WriteQuadVertex(quad[0], world, -w, h, 0.f, 0.f);  // top left
+            WriteQuadVertex(quad[1], world, w, h, 1.f, 0.f);   // top right
+            WriteQuadVertex(quad[2], world, w, -h, 1.f, 1.f);  // bottom right
+            WriteQuadVertex(quad[3], world, -w, -h, 0.f, 1.f); // bottom left
+        }
+    });
 }
 
-void AddMesh(MeshComponent* mesh)
+} // anonymous namespace
+
+bool Initialize()
 {
-    meshes.emplace_back(mesh);
+    gl_state::Invalidate();
+    if (!LoadShaders())
+    {
+        LOG_ERROR("Failed to load shaders");
+        return false;
+    }
+    sprite_batch = DBG_NEW SpriteBatch();
+    glCreateBuffers(1, &instance_data_buffer);
+    glCreateBuffers(1, &material_buffer);
+    glCreateBuffers(1, &indirect_buffer);
+    glCreateBuffers(1, &draw_id_buffer);
+    mesh_buffer::Initialize();
+    gpu_profiler::Initialize();
+
+    return true;
 }
 
-void RemoveMesh(MeshComponent* mesh)
+void Shutdown()
 {
-    const auto it = std::ranges::find(meshes, mesh);
-    meshes.erase(it);
+    gpu_profiler::Shutdown();
+    SAFE_DELETE(sprite_batch);
+    glDeleteBuffers(1, &instance_data_buffer);
+    glDeleteBuffers(1, &material_buffer);
+    glDeleteBuffers(1, &indirect_buffer);
+    glDeleteBuffers(1, &draw_id_buffer);
+    glDeleteBuffers(1, &frame_data_buffer);
+    core::UnloadTextures();
+    core::UnloadShaders();
+    core::UnloadMeshes();
+    mesh_buffer::Shutdown();
 }
 
 void SetViewMatrix(const mat4& _view)
 {
     view = _view;
+
+    // Only the camera position is needed from the inverse, so pay for it when the view changes rather than every frame
+    mat4 inv_view = view;
+    inv_view.Invert();
+    camera_pos = inv_view.Translation();
 }
 
 void SetAmbientLight(const vec3& ambient)
@@ -170,37 +506,65 @@ DirectionalLight& GetDirectionalLight()
 
 void Render()
 {
+    PROFILE_FUNCTION();
+    gpu_profiler::BeginFrame();
+    gl_state::BeginFrame();
+
     glClearColor(0.f, 0.f, 0.f, 1.f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    glEnable(GL_DEPTH_TEST);
-    glDisable(GL_BLEND);
+    gl_state::SetDepthTest(true);
+    gl_state::SetBlend(false);
 
-    mesh_shader->Activate();
-    mesh_shader->SetMatrix("ViewProj", view * projection);
-    SetLightUniforms(mesh_shader);
+    const mat4 view_proj = view * projection;
+    UploadFrameData(view_proj);
+
+    render_queue.Clear();
+    CullMeshes(Frustum::FromMatrix(view_proj));
+    SubmitSprites();
+    render_queue.Sort();
+
+    const u32 first_sprite = render_queue.First(draw_key::Pass::sprite);
 
-    for (const auto mc : meshes)
     {
-        mc->Draw(mesh_shader);
+        PROFILE_SCOPE("Meshes");
+        PROFILE_GPU_SCOPE("Meshes");
+        mesh_shader->Activate();
+
+        BuildMeshInstances(0, first_sprite);
+        DrawMeshGroups();
     }
 
-    glDisable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
+    gl_state::SetDepthTest(false);
+    gl_state::SetBlend(true);
 
-    glBlendEquationSeparate(GL_FUNC_ADD, GL_FUNC_ADD);
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+    gl_state::SetBlendEquation(GL_FUNC_ADD, GL_FUNC_ADD);
+    gl_state::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
 
+    PROFILE_SCOPE("Sprites");
+    PROFILE_GPU_SCOPE("Sprites");
     sprite_shader->Activate();
-    sprite_verts->Activate();
-    for (const auto sprite : sprites)
+
+    sprite_order.clear();
+    for (u32 i = first_sprite; i < render_queue.Size(); ++i)
+    {
+        sprite_order.emplace_back(render_queue[i].index);
+    }
+
+    const u32 sprite_count = (u32) sprite_order.size();
+    WriteSpriteQuads(sprite_batch->Begin(sprite_count));
+
+    const ecs::SpriteData* sprites = ecs::SpritePool().Data();
+    for (u32 i = 0; i < sprite_count; ++i)
     {
-        sprite->Draw(sprite_shader);
+        sprite_batch->AddRun(sprites[sprite_order[i]].texture, 1);
     }
+    sprite_batch->End();
 }
-void DrawIndexed(i32 count)
+
+const CullStats& GetCullStats()
 {
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+    return cull_stats;
 }
 
 f32 ScreenWidth()
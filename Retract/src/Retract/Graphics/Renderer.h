@@ -24,8 +24,6 @@
 #pragma once
 
 #include "Retract/Common.h"
-#include "Retract/Components/Sprite.h"
-#include "Retract/Components/MeshComponent.h"
 
 namespace retract::graphics
 {
@@ -40,12 +38,6 @@ struct DirectionalLight
 bool Initialize();
 void Shutdown();
 
-void AddSprite(Sprite* sprite);
-void RemoveSprite(Sprite* sprite);
-
-void AddMesh(MeshComponent* mesh);
-void RemoveMesh(MeshComponent* mesh);
-
 
 void SetViewMatrix(const mat4& view);
 
@@ -54,7 +46,16 @@ DirectionalLight& GetDirectionalLight();
 
 void Render();
 
-void DrawIndexed(i32 count);
+// Mesh pass of the last Render: loaded meshes tested against the frustum, rejected and drawn
+struct CullStats
+{
+    u32 tested{};
+    u32 culled{};
+    u32 drawn{};
+    u32 simplified{}; // drawn at a coarser LOD than the full mesh
+};
+
+const CullStats& GetCullStats();
 
 f32 ScreenWidth();
 f32 ScreenHeight();
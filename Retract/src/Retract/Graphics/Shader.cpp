@@ -21,6 +21,7 @@
 //
 //  ------------------------------------------------------------------------------
 #include "Shader.h"
+#include "GLState.h"
 
 
 #include <fstream>
@@ -81,10 +82,6 @@ Shader::Shader(const std::string& vertex, const std::string& frag)
 {
     Load(vertex, frag);
 }
-Shader::~Shader()
-{
-    LOG_WARN("Deleting shader");
-}
 
 bool Shader::Load(const std::string& vertex, const std::string& frag)
 {
@@ -98,11 +95,16 @@ bool Shader::Load(const std::string& vertex, const std::string& frag)
     glAttachShader(mProgram, mFragShader);
     glLinkProgram(mProgram);
 
-    return IsValid();
+    if (!IsValid())
+        return false;
+
+    Reflect();
+    return true;
 }
 
 void Shader::Unload() const
 {
+    graphics::gl_state::ForgetProgram(mProgram);
     glDeleteProgram(mProgram);
     glDeleteShader(mVertexShader);
     glDeleteShader(mFragShader);
@@ -110,28 +112,76 @@ void Shader::Unload() const
 
 void Shader::Activate() const
 {
-    glUseProgram(mProgram);
+    graphics::gl_state::UseProgram(mProgram);
+}
+
+void Shader::SetMatrix(UniformId name, const mat4& matrix) const
+{
+    glUniformMatrix4fv(Location(name), 1, GL_TRUE, matrix.data());
+}
+
+void Shader::SetVector(UniformId name, const vec3& vec) const
+{
+    glUniform3fv(Location(name), 1, vec.data());
 }
 
-void Shader::SetMatrix(const char* name, const mat4& matrix) const
+void Shader::SetFloat(UniformId name, f32 value) const
 {
-    const GLint loc = glGetUniformLocation(mProgram, name);
-    assert(loc != -1);
-    glUniformMatrix4fv(loc, 1, GL_TRUE, matrix.data());
+    glUniform1f(Location(name), value);
 }
 
-void Shader::SetVector(const char* name, const vec3& vec) const
+void Shader::Reflect()
 {
-    const GLint loc = glGetUniformLocation(mProgram, name);
-    assert(loc != -1);
-    glUniform3fv(loc, 1, vec.data());
+    mUniforms.clear();
+
+    GLint count{};
+    glGetProgramiv(mProgram, GL_ACTIVE_UNIFORMS, &count);
+    for (GLint i = 0; i < count; ++i)
+    {
+        char    buffer[128] = {};
+        GLsizei length{};
+        GLint   size{};
+        GLenum  type{};
+        glGetActiveUniform(mProgram, (GLuint) i, sizeof(buffer), &length, &size, &type, buffer);
+
+        // Members of uniform blocks have no location
+        const GLint loc = glGetUniformLocation(mProgram, buffer);
+        if (loc == -1)
+            continue;
+
+        // Arrays are reported as "name[0]", make them reachable by plain name as well
+        std::string_view name{ buffer, (size_t) length };
+        mUniforms[UniformId::Hash(name)] = loc;
+        if (name.ends_with("[0]"))
+        {
+            name.remove_suffix(3);
+            mUniforms[UniformId::Hash(name)] = loc;
+        }
+    }
+
+    if (const GLuint block = glGetUniformBlockIndex(mProgram, "FrameData"); block != GL_INVALID_INDEX)
+    {
+        glUniformBlockBinding(mProgram, block, frame_data_binding);
+    }
+
+    const auto bind_storage_block = [this](const char* name, u32 binding) {
+        if (const GLuint block = glGetProgramResourceIndex(mProgram, GL_SHADER_STORAGE_BLOCK, name); block != GL_INVALID_INDEX)
+        {
+            glShaderStorageBlockBinding(mProgram, block, binding);
+        }
+    };
+    bind_storage_block("InstanceData", instance_data_binding);
+    bind_storage_block("MaterialData", material_data_binding);
 }
 
-void Shader::SetFloat(const char* name, f32 value) const
+GLint Shader::Location(UniformId name) const
 {
-    const GLint loc = glGetUniformLocation(mProgram, name);
-    assert(loc != -1);
-    glUniform1f(loc, value);
+    const auto [it, inserted] = mUniforms.try_emplace(name.hash, -1);
+    if (inserted)
+    {
+        LOG_WARN("Shader program {} has no active uniform '{}', setting it does nothing", mProgram, name.name);
+    }
+    return it->second;
 }
 
 bool Shader::IsValid() const
@@ -28,31 +28,69 @@
 
 #include <GL/glew.h>
 
+#include <string_view>
+#include <unordered_map>
+
 namespace retract
 {
 
+// Binding point of the per frame FrameData uniform block shared by every program
+constexpr u32 frame_data_binding = 0;
+// Shader storage binding points of the mesh pass' InstanceData and MaterialData blocks
+constexpr u32 instance_data_binding = 0;
+constexpr u32 material_data_binding = 1;
+
+// Uniforms are looked up by the FNV-1a hash of their name, string literals are hashed at compile time
+struct UniformId
+{
+    consteval UniformId(const char* name) : hash{ Hash(name) }, name{ name } {}
+
+    static constexpr u32 Hash(std::string_view name)
+    {
+        u32 h = 2166136261u;
+        for (const char c : name)
+        {
+            h = (h ^ (u8) c) * 16777619u;
+        }
+        return h;
+    }
+
+    u32         hash;
+    const char* name; // The literal it was made from, for logging
+};
+
 class Shader
 {
 public:
     Shader() = default;
     Shader(const std::string& vertex, const std::string& frag);
-    ~Shader();
 
     bool Load(const std::string& vertex, const std::string& frag);
     void Unload() const;
 
     void Activate() const;
 
-    void SetMatrix(const char* name, const mat4& matrix) const;
-    void SetVector(const char* name, const vec3& vec) const;
-    void SetFloat(const char* name, f32 value) const;
+    void SetMatrix(UniformId name, const mat4& matrix) const;
+    void SetVector(UniformId name, const vec3& vec) const;
+    void SetFloat(UniformId name, f32 value) const;
+
+    constexpr u32 Id() const { return mProgram; }
 
 private:
     bool IsValid() const;
 
+    // Fills mUniforms from the linked program and hooks up the FrameData, InstanceData and MaterialData blocks
+    // the program uses
+    void  Reflect();
+    // -1 for uniforms the program doesn't have (or the compiler stripped), which GL ignores. Logged once per uniform
+    GLint Location(UniformId name) const;
+
     GLuint mVertexShader{};
     GLuint mFragShader{};
     GLuint mProgram{};
+
+    // Misses are added as -1 on first lookup so they are only reported once
+    mutable std::unordered_map<u32, GLint> mUniforms{};
 };
 
 } // namespace retract
\ No newline at end of file
@@ -0,0 +1,171 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: SpriteBatch.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "SpriteBatch.h"
+
+#include "GLState.h"
+#include "Texture.h"
+
+namespace retract
+{
+
+namespace
+{
+void WaitForFence(GLsync& fence)
+{
+    if (!fence)
+        return;
+
+    GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    while (result == GL_TIMEOUT_EXPIRED)
+    {
+        result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+    }
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+} // anonymous namespace
+
+SpriteBatch::SpriteBatch(u32 capacity)
+{
+    Create(capacity);
+}
+
+SpriteBatch::~SpriteBatch()
+{
+    Destroy();
+}
+
+SpriteBatch::Vertex* SpriteBatch::Begin(u32 quad_count)
+{
+    mRuns.clear();
+    mRegion = (mRegion + 1) % regions;
+
+    if (quad_count > mCapacity)
+    {
+        u32 capacity = mCapacity;
+        while (capacity < quad_count)
+        {
+            capacity *= 2;
+        }
+
+        LOG_INFO("Growing sprite batch to {} sprites", capacity);
+        Destroy();
+        Create(capacity);
+    }
+
+    WaitForFence(mFences[mRegion]);
+    return mMapped + (u64) mRegion * mCapacity * vertices_per_quad;
+}
+
+void SpriteBatch::AddRun(const Texture* texture, u32 quad_count)
+{
+    if (!mRuns.empty() && mRuns.back().texture == texture)
+    {
+        mRuns.back().quad_count += quad_count;
+        return;
+    }
+
+    mRuns.emplace_back(Run{ texture, quad_count });
+}
+
+void SpriteBatch::End()
+{
+    graphics::gl_state::BindVertexArray(mVao);
+
+    // Every run reuses the start of the index buffer and offsets into the region with the base vertex
+    u32 first_quad = mRegion * mCapacity;
+    for (const Run& run : mRuns)
+    {
+        if (run.texture)
+        {
+            run.texture->Activate();
+            glDrawElementsBaseVertex(GL_TRIANGLES, (i32) (run.quad_count * 6), GL_UNSIGNED_INT, nullptr,
+                                     (i32) (first_quad * vertices_per_quad));
+        }
+        first_quad += run.quad_count;
+    }
+
+    mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void SpriteBatch::Create(u32 capacity)
+{
+    mCapacity = math::Max(capacity, 1u);
+
+    // Same winding as the old shared quad: top left, top right, bottom right, bottom left
+    utl::vector<u32> indices(mCapacity * 6);
+    for (u32 i = 0; i < mCapacity; ++i)
+    {
+        const u32 v        = i * vertices_per_quad;
+        indices[i * 6 + 0] = v + 0;
+        indices[i * 6 + 1] = v + 1;
+        indices[i * 6 + 2] = v + 2;
+        indices[i * 6 + 3] = v + 2;
+        indices[i * 6 + 4] = v + 3;
+        indices[i * 6 + 5] = v + 0;
+    }
+
+    glCreateVertexArrays(1, &mVao);
+    graphics::gl_state::BindVertexArray(mVao);
+
+    glCreateBuffers(1, &mIbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIbo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr) (indices.size() * sizeof(u32)), indices.data(), GL_STATIC_DRAW);
+
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const GLsizeiptr size  = (GLsizeiptr) regions * mCapacity * vertices_per_quad * sizeof(Vertex);
+
+    glCreateBuffers(1, &mVbo);
+    glBindBuffer(GL_ARRAY_BUFFER, mVbo);
+    glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+    mMapped = (Vertex*) glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+
+    // Position is 2 floats
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), nullptr);
+
+    // Tex coords are 2 floats
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(sizeof(f32) * 2));
+}
+
+void SpriteBatch::Destroy()
+{
+    for (GLsync& fence : mFences)
+    {
+        WaitForFence(fence);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVbo);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    mMapped = nullptr;
+
+    glDeleteBuffers(1, &mVbo);
+    glDeleteBuffers(1, &mIbo);
+    graphics::gl_state::ForgetVertexArray(mVao);
+    glDeleteVertexArrays(1, &mVao);
+}
+
+} // namespace retract
@@ -0,0 +1,86 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: SpriteBatch.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Retract/Common.h"
+
+#include <GL/glew.h>
+
+namespace retract
+{
+class Texture;
+
+// Streams pre-transformed sprite quads through a persistently mapped vertex buffer split in three
+// regions, one per frame in flight. A fence per region keeps the CPU from overwriting vertices the
+// GPU is still reading. Quads are drawn in the order they are written, one draw per texture run.
+class SpriteBatch
+{
+public:
+    struct Vertex
+    {
+        f32 x, y;
+        f32 u, v;
+    };
+
+    static constexpr u32 vertices_per_quad = 4;
+    static constexpr u32 regions           = 3;
+
+    explicit SpriteBatch(u32 capacity = 4096);
+    ~SpriteBatch();
+
+    // Returns room for quad_count quads (4 vertices each) in this frame's region, growing the buffer if needed.
+    // The memory is write only and may be filled from any thread until End
+    Vertex* Begin(u32 quad_count);
+
+    // The next quad_count quads written since the last run all use texture
+    void AddRun(const Texture* texture, u32 quad_count);
+
+    // Issues the draws and fences the region. The sprite shader has to be active
+    void End();
+
+    constexpr u32 Capacity() const { return mCapacity; }
+    constexpr u32 DrawCalls() const { return (u32) mRuns.size(); }
+
+private:
+    struct Run
+    {
+        const Texture* texture{};
+        u32            quad_count{};
+    };
+
+    void Create(u32 capacity);
+    void Destroy();
+
+    u32     mVao{};
+    u32     mVbo{};
+    u32     mIbo{};
+    Vertex* mMapped{};
+    u32     mCapacity{};
+    u32     mRegion{};
+    GLsync  mFences[regions]{};
+
+    utl::vector<Run> mRuns{};
+};
+
+} // namespace retract
@@ -21,13 +21,23 @@
 //
 //  ------------------------------------------------------------------------------
 #include "Texture.h"
+#include "GLState.h"
 
 #include <GL/glew.h>
 #include <SOIL2/SOIL2.h>
 
+#include <mutex>
+
 namespace retract
 {
 
+namespace
+{
+// SOIL keeps its last error in a global, loads from several loader threads would overwrite each other's
+// result before it is read. Decoding one image at a time keeps the pair consistent
+std::mutex soil_mutex{};
+} // anonymous namespace
+
 Texture::Texture(const std::string& filename)
 {
     Load(filename);
@@ -37,46 +47,92 @@ Texture::~Texture()
     LOG_WARN("Deleting texture");
 }
 
+Texture::Image::~Image()
+{
+    if (pixels)
+    {
+        SOIL_free_image_data(pixels);
+    }
+}
+
 bool Texture::Load(const std::string& filename)
 {
-    LOG_INFO("Loading texture {}", filename);
-    i32 channels = 0;
+    Image image{};
+    if (!Decode(filename, image))
+    {
+        return false;
+    }
+
+    Upload(image);
+    return true;
+}
 
-    u8* image = SOIL_load_image(filename.c_str(), &mWidth, &mHeight, &channels, SOIL_LOAD_AUTO);
+bool Texture::Decode(const std::string& filename, Image& out)
+{
+    PROFILE_SCOPE("Decode texture");
+    LOG_INFO("Loading texture {}", filename);
+    std::string error{};
+    {
+        std::lock_guard lock{ soil_mutex };
+        out.pixels = SOIL_load_image(filename.c_str(), &out.width, &out.height, &out.channels, SOIL_LOAD_AUTO);
+        if (!out.pixels)
+        {
+            error = SOIL_last_result();
+        }
+    }
 
-    if (!image)
+    if (!out.pixels)
     {
-        LOG_ERROR("Failed to load image '{}' - {}", filename, SOIL_last_result());
+        LOG_ERROR("Failed to load image '{}' - {}", filename, error);
         return false;
     }
 
+    return true;
+}
+
+void Texture::Upload(const Image& image)
+{
+    PROFILE_SCOPE("Upload texture");
     i32 format = GL_RGB;
-    if (channels == 4)
+    if (image.channels == 4)
     {
         format = GL_RGBA;
     }
 
-    glGenTextures(1, &mId);
-    glBindTexture(GL_TEXTURE_2D, mId);
+    mPlaceholder = false;
+    mWidth       = image.width;
+    mHeight      = image.height;
 
-    glTexImage2D(GL_TEXTURE_2D, 0, format, mWidth, mHeight, 0, format, GL_UNSIGNED_BYTE, image);
+    glGenTextures(1, &mId);
+    graphics::gl_state::BindTexture(0, mId);
 
-    SOIL_free_image_data(image);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, mWidth, mHeight, 0, format, GL_UNSIGNED_BYTE, image.pixels);
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
 
-    return true;
+void Texture::SetPlaceholder(const Texture* placeholder)
+{
+    mPlaceholder = true;
+    mId          = placeholder ? placeholder->mId : 0;
+    mWidth       = placeholder ? placeholder->mWidth : 0;
+    mHeight      = placeholder ? placeholder->mHeight : 0;
 }
 
 void Texture::Unload() const
 {
-    glDeleteTextures(1, &mId);
+    // A placeholder borrows the GL texture of another one
+    if (!mPlaceholder)
+    {
+        graphics::gl_state::ForgetTexture(mId);
+        glDeleteTextures(1, &mId);
+    }
 }
 
 void Texture::Activate() const
 {
-    glBindTexture(GL_TEXTURE_2D, mId);
+    graphics::gl_state::BindTexture(0, mId);
 }
 
 }
\ No newline at end of file
@@ -30,6 +30,20 @@ namespace retract
 class Texture
 {
 public:
+    // Decoded pixels, produced off the render thread and handed to Upload
+    struct Image
+    {
+        Image() = default;
+        ~Image();
+        Image(const Image&)            = delete;
+        Image& operator=(const Image&) = delete;
+
+        u8* pixels{};
+        i32 width{};
+        i32 height{};
+        i32 channels{};
+    };
+
     Texture() = default;
     Texture(const std::string& filename);
     ~Texture();
@@ -38,14 +52,24 @@ public:
     void Unload() const;
     void Activate() const;
 
+    // Load split in two: Decode can be called from any thread but decodes one image at a time since SOIL keeps
+    // global state, Upload needs the GL context
+    static bool Decode(const std::string& filename, Image& out);
+    void        Upload(const Image& image);
+
+    // Draws as placeholder until Upload gives the texture its own image
+    void           SetPlaceholder(const Texture* placeholder);
+    constexpr bool IsPlaceholder() const { return mPlaceholder; }
+
     constexpr u32 Id() const { return mId; }
     constexpr i32 Width() const { return mWidth; }
     constexpr i32 Height() const { return mHeight; }
 
 private:
-    u32 mId{};
-    i32 mWidth{};
-    i32 mHeight{};
+    u32  mId{};
+    i32  mWidth{};
+    i32  mHeight{};
+    bool mPlaceholder{ false };
 };
 
 }
@@ -0,0 +1,362 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Collision.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "Collision.h"
+
+#include "Retract/Components/Entity.h"
+#include "Retract/Core/Jobs.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace retract::physics
+{
+
+namespace
+{
+// Inclusive cell coordinates covered by a collider's bounding box, empty until first inserted
+struct CellRange
+{
+    i32 min[3]{ 0, 0, 0 };
+    i32 max[3]{ -1, -1, -1 };
+
+    bool operator==(const CellRange&) const = default;
+};
+
+struct Cell
+{
+    u64              key{};
+    utl::vector<u32> ids{};
+};
+
+utl::vector<vec3>      centers{};
+utl::vector<f32>       radii{};
+utl::vector<Entity*>   owners{};
+utl::vector<u32>       layers{};
+utl::vector<u32>       masks{};
+utl::vector<CellRange> ranges{};
+utl::vector<u8>        moved{};
+utl::vector<u32>       free_ids{};
+
+// Cells live in a dense array so finding the busy ones is a linear scan. Cells that empty out are kept
+// for whoever moves in next and only dropped once they make up most of the array
+std::unordered_map<u64, u32> cell_lookup{};
+utl::vector<Cell>            cells{};
+u32                          empty_cells{ 0 };
+f32                          cell_size{ 100.f };
+constexpr u32                min_empty_cells_to_compact = 1024;
+
+// Cells holding more than one collider, their pairs are found in parallel batches
+utl::vector<const Cell*>       busy_cells{};
+utl::vector<utl::vector<Pair>> batch_pairs{};
+utl::vector<Pair>              pairs{};
+constexpr u32                  pair_batch_size = 64;
+
+// Colliders already visited by the current Query, a collider usually sits in several of the cells it looks at
+utl::vector<u32> query_stamps{};
+u32              query_stamp{ 0 };
+
+// 21 bits per axis. Cells two million apart share a key, which only costs extra narrow phase tests
+u64 CellKey(i32 x, i32 y, i32 z)
+{
+    constexpr u64 axis_mask = (1ull << 21) - 1;
+    return ((u64) x & axis_mask) | (((u64) y & axis_mask) << 21) | (((u64) z & axis_mask) << 42);
+}
+
+i32 CellCoord(f32 v)
+{
+    return (i32) std::floor(v / cell_size);
+}
+
+CellRange RangeOf(const vec3& center, f32 radius)
+{
+    return CellRange{
+        { CellCoord(center.x - radius), CellCoord(center.y - radius), CellCoord(center.z - radius) },
+        { CellCoord(center.x + radius), CellCoord(center.y + radius), CellCoord(center.z + radius) },
+    };
+}
+
+template<typename Func>
+void ForEachCell(const CellRange& range, Func&& func)
+{
+    for (i32 z = range.min[2]; z <= range.max[2]; ++z)
+    {
+        for (i32 y = range.min[1]; y <= range.max[1]; ++y)
+        {
+            for (i32 x = range.min[0]; x <= range.max[0]; ++x)
+            {
+                func(CellKey(x, y, z));
+            }
+        }
+    }
+}
+
+void Insert(u32 id, const CellRange& range)
+{
+    ForEachCell(range, [id](u64 key) {
+        const auto [it, added] = cell_lookup.try_emplace(key, (u32) cells.size());
+        if (added)
+        {
+            cells.emplace_back(Cell{ key });
+        } else if (cells[it->second].ids.empty())
+        {
+            --empty_cells;
+        }
+        cells[it->second].ids.emplace_back(id);
+    });
+}
+
+void Erase(u32 id, const CellRange& range)
+{
+    ForEachCell(range, [id](u64 key) {
+        utl::vector<u32>& ids = cells[cell_lookup[key]].ids;
+
+        *std::ranges::find(ids, id) = ids.back();
+        ids.pop_back();
+        if (ids.empty())
+        {
+            ++empty_cells;
+        }
+    });
+}
+
+void CompactCells()
+{
+    cell_lookup.clear();
+    std::erase_if(cells, [](const Cell& cell) { return cell.ids.empty(); });
+    for (u32 i = 0; i < (u32) cells.size(); ++i)
+    {
+        cell_lookup.emplace(cells[i].key, i);
+    }
+    empty_cells = 0;
+}
+
+bool LayersMatch(u32 a, u32 b)
+{
+    return (layers[a] & masks[b]) || (layers[b] & masks[a]);
+}
+
+void FindPairs(const Cell& cell, utl::vector<Pair>& out)
+{
+    const utl::vector<u32>& ids   = cell.ids;
+    const u32               count = (u32) ids.size();
+    for (u32 i = 0; i < count; ++i)
+    {
+        for (u32 j = i + 1; j < count; ++j)
+        {
+            const u32 a = ids[i];
+            const u32 b = ids[j];
+
+            // Colliders sharing several cells meet in each of them, only the lowest shared cell reports them
+            const CellRange& ra    = ranges[a];
+            const CellRange& rb    = ranges[b];
+            const u64        first = CellKey(math::Max(ra.min[0], rb.min[0]), math::Max(ra.min[1], rb.min[1]),
+                                             math::Max(ra.min[2], rb.min[2]));
+            if (first != cell.key || !LayersMatch(a, b) || !Intersect(a, b))
+                continue;
+
+            out.emplace_back(Pair{ math::Min(a, b), math::Max(a, b) });
+        }
+    }
+}
+} // anonymous namespace
+
+u32 AddCollider(Entity* owner, f32 radius)
+{
+    u32 id;
+    if (!free_ids.empty())
+    {
+        id = free_ids.back();
+        free_ids.pop_back();
+    } else
+    {
+        id = (u32) centers.size();
+        centers.emplace_back();
+        radii.emplace_back();
+        owners.emplace_back();
+        layers.emplace_back();
+        masks.emplace_back();
+        ranges.emplace_back();
+        moved.emplace_back();
+        query_stamps.emplace_back();
+    }
+
+    centers[id] = owner->WorldPosition();
+    radii[id]   = radius;
+    owners[id]  = owner;
+    layers[id]  = 1;
+    masks[id]   = all_layers;
+    ranges[id]  = {};
+    moved[id]   = true;
+    return id;
+}
+
+void RemoveCollider(u32 id)
+{
+    Erase(id, ranges[id]);
+    ranges[id] = {};
+    moved[id]  = false;
+    owners[id] = nullptr;
+    free_ids.emplace_back(id);
+}
+
+void SetSphere(u32 id, const vec3& center, f32 radius)
+{
+    centers[id] = center;
+    radii[id]   = radius;
+    moved[id]   = true;
+}
+
+void SetLayer(u32 id, u32 layer, u32 mask)
+{
+    layers[id] = layer;
+    masks[id]  = mask;
+}
+
+const vec3& Center(u32 id)
+{
+    return centers[id];
+}
+
+f32 Radius(u32 id)
+{
+    return radii[id];
+}
+
+Entity* Owner(u32 id)
+{
+    return owners[id];
+}
+
+void SetCellSize(f32 size)
+{
+    assert(size > 0.f);
+    cell_size = size;
+
+    cells.clear();
+    cell_lookup.clear();
+    empty_cells = 0;
+    for (u32 id = 0; id < (u32) owners.size(); ++id)
+    {
+        ranges[id] = {};
+        moved[id]  = owners[id] != nullptr;
+    }
+}
+
+void Update()
+{
+    PROFILE_SCOPE("Collision update");
+    const u32 count = (u32) centers.size();
+    for (u32 id = 0; id < count; ++id)
+    {
+        if (!moved[id])
+            continue;
+
+        moved[id]             = false;
+        const CellRange range = RangeOf(centers[id], radii[id]);
+        if (range != ranges[id])
+        {
+            Erase(id, ranges[id]);
+            Insert(id, range);
+            ranges[id] = range;
+        }
+    }
+
+    if (empty_cells > min_empty_cells_to_compact && empty_cells * 2 > (u32) cells.size())
+    {
+        CompactCells();
+    }
+
+    busy_cells.clear();
+    for (const Cell& cell : cells)
+    {
+        if (cell.ids.size() > 1)
+            busy_cells.emplace_back(&cell);
+    }
+
+    // Each batch owns one output
+    const u32 cell_count  = (u32) busy_cells.size();
+    const u32 batch_count = jobs::BatchCount(cell_count, pair_batch_size);
+    if (batch_pairs.size() < batch_count)
+    {
+        batch_pairs.resize(batch_count);
+    }
+
+    jobs::ParallelForBatches(cell_count, pair_batch_size, [](u32 batch, u32 begin, u32 end) {
+        utl::vector<Pair>& out = batch_pairs[batch];
+        out.clear();
+        for (u32 i = begin; i < end; ++i)
+        {
+            FindPairs(*busy_cells[i], out);
+        }
+    });
+
+    pairs.clear();
+    for (u32 b = 0; b < batch_count; ++b)
+    {
+        pairs.insert(pairs.end(), batch_pairs[b].begin(), batch_pairs[b].end());
+    }
+}
+
+const utl::vector<Pair>& Pairs()
+{
+    return pairs;
+}
+
+void Query(const vec3& center, f32 radius, utl::vector<u32>& out, u32 mask)
+{
+    if (++query_stamp == 0)
+    {
+        std::ranges::fill(query_stamps, 0u);
+        query_stamp = 1;
+    }
+
+    // Goes by the cells of the last Update, colliders that moved since are looked up where they were then
+    ForEachCell(RangeOf(center, radius), [&](u64 key) {
+        const auto it = cell_lookup.find(key);
+        if (it == cell_lookup.end())
+            return;
+
+        for (const u32 id : cells[it->second].ids)
+        {
+            if (query_stamps[id] == query_stamp)
+                continue;
+
+            query_stamps[id] = query_stamp;
+            const f32 r      = radius + radii[id];
+            if ((layers[id] & mask) && (centers[id] - center).LengthSq() <= r * r)
+            {
+                out.emplace_back(id);
+            }
+        }
+    });
+}
+
+bool Intersect(u32 a, u32 b)
+{
+    const f32 r = radii[a] + radii[b];
+    return (centers[a] - centers[b]).LengthSq() <= r * r;
+}
+
+} // namespace retract::physics
@@ -0,0 +1,78 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Collision.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Common.h"
+
+namespace retract
+{
+class Entity;
+} // namespace retract
+
+namespace retract::physics
+{
+
+// Sphere colliders in a uniform spatial hash. A collider is stored in every cell its bounding box
+// touches and is only moved between cells when that range of cells changes, so colliders that
+// move a little or not at all cost nothing to keep up to date. Pairs are found per cell.
+//
+// Everything except SetSphere is main thread only
+
+struct Pair
+{
+    u32 a; // a < b
+    u32 b;
+};
+
+constexpr u32 all_layers = ~0u;
+
+u32  AddCollider(Entity* owner, f32 radius = 0.f);
+void RemoveCollider(u32 id);
+
+// Thread safe for distinct ids, meant to be called from OnUpdateWorldTransform
+void SetSphere(u32 id, const vec3& center, f32 radius);
+
+// A pair is reported when either collider's layer is in the other's mask
+void SetLayer(u32 id, u32 layer, u32 mask = all_layers);
+
+const vec3& Center(u32 id);
+f32         Radius(u32 id);
+Entity*     Owner(u32 id);
+
+// Roughly the diameter of a typical collider. Changing it rebuilds the hash
+void SetCellSize(f32 size);
+
+// Moves changed colliders between cells and finds every overlapping pair
+void Update();
+
+// Overlapping pairs found by the last Update, each pair once
+const utl::vector<Pair>& Pairs();
+
+// Colliders overlapping the sphere, appended to out
+void Query(const vec3& center, f32 radius, utl::vector<u32>& out, u32 mask = all_layers);
+
+bool Intersect(u32 a, u32 b);
+
+} // namespace retract::physics
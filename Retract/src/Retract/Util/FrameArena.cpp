@@ -0,0 +1,188 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: FrameArena.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "FrameArena.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace retract::memory
+{
+
+namespace
+{
+constexpr size_t Align(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+LinearArena frame_arenas[2]{ LinearArena{ frame_arena_size }, LinearArena{ frame_arena_size } };
+u32         frame_index{ 0 };
+
+std::atomic<u64> heap_allocations{ 0 };
+u64              frame_start_allocations{ 0 };
+u32              last_frame_allocations{ 0 };
+} // anonymous namespace
+
+LinearArena::LinearArena(size_t capacity) : mBase{ (u8*) ::operator new(capacity) }, mCapacity{ capacity } {}
+
+LinearArena::~LinearArena()
+{
+    for (u8* block : mOverflow)
+    {
+        ::operator delete(block);
+    }
+    ::operator delete(mBase);
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment)
+{
+    assert(alignment <= alignof(std::max_align_t) && (alignment & (alignment - 1)) == 0);
+
+    const size_t offset = Align(mUsed, alignment);
+    if (offset + size <= mCapacity)
+    {
+        mUsed = offset + size;
+        return mBase + offset;
+    }
+
+    // Only until the next Reset, which makes room for all of it in the main block
+    u8* block = (u8*) ::operator new(size);
+    mOverflow.emplace_back(block);
+    mOverflowUsed += Align(size, alignof(std::max_align_t));
+    return block;
+}
+
+void LinearArena::Reset()
+{
+    if (!mOverflow.empty())
+    {
+        for (u8* block : mOverflow)
+        {
+            ::operator delete(block);
+        }
+        mOverflow.clear();
+
+        const size_t needed = Used();
+        LOG_WARN("Arena of {} bytes overflowed, growing to {} bytes", mCapacity, needed);
+        ::operator delete(mBase);
+        mBase         = (u8*) ::operator new(needed);
+        mCapacity     = needed;
+        mOverflowUsed = 0;
+    }
+
+    mUsed = 0;
+}
+
+void BeginFrame()
+{
+    frame_index = (frame_index + 1) & 1;
+    frame_arenas[frame_index].Reset();
+
+    const u64 allocations   = HeapAllocations();
+    last_frame_allocations  = (u32) (allocations - frame_start_allocations);
+    frame_start_allocations = allocations;
+}
+
+void* FrameAllocate(size_t size, size_t alignment)
+{
+    return frame_arenas[frame_index].Allocate(size, alignment);
+}
+
+size_t FrameBytesUsed()
+{
+    return frame_arenas[frame_index].Used();
+}
+
+u64 HeapAllocations()
+{
+    return heap_allocations.load(std::memory_order_relaxed);
+}
+
+u32 LastFrameHeapAllocations()
+{
+    return last_frame_allocations;
+}
+
+} // namespace retract::memory
+
+#if RETRACT_COUNT_ALLOCATIONS
+// Replacements for the plain forms of global new and delete. The aligned forms keep the default implementation, which
+// pairs with its own delete, and MSVC's debug new used by DBG_NEW goes straight to the CRT so neither is counted
+void* operator new(size_t size)
+{
+    retract::memory::heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    retract::memory::heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+#endif
@@ -0,0 +1,107 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: FrameArena.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Common.h"
+
+#include <cstddef>
+#include <string>
+
+// Every global operator new is counted so per frame heap traffic can be tracked down. On in debug by default,
+// define RETRACT_COUNT_ALLOCATIONS as 0 or 1 to override
+#ifndef RETRACT_COUNT_ALLOCATIONS
+    #ifdef _DEBUG
+        #define RETRACT_COUNT_ALLOCATIONS 1
+    #else
+        #define RETRACT_COUNT_ALLOCATIONS 0
+    #endif
+#endif
+
+namespace retract::memory
+{
+
+// Bump allocator, everything is freed at once by Reset. Running out chains extra heap blocks for the rest of the
+// cycle and the next Reset grows the main block to fit, so it settles at the high water mark. Not thread safe
+class LinearArena
+{
+public:
+    explicit LinearArena(size_t capacity);
+    ~LinearArena();
+
+    LinearArena(const LinearArena&)            = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void                Reset();
+
+    [[nodiscard]] constexpr size_t Used() const { return mUsed + mOverflowUsed; }
+    [[nodiscard]] constexpr size_t Capacity() const { return mCapacity; }
+
+private:
+    u8*              mBase{};
+    size_t           mCapacity{};
+    size_t           mUsed{};
+    utl::vector<u8*> mOverflow{};
+    size_t           mOverflowUsed{};
+};
+
+constexpr size_t frame_arena_size = 1_MB;
+
+// Two frame arenas take turns, BeginFrame resets the older one. Memory from FrameAllocate is good until the end of
+// the next frame, so it can be handed to something still using it a frame later. Main thread only
+void   BeginFrame();
+void*  FrameAllocate(size_t size, size_t alignment = alignof(std::max_align_t));
+size_t FrameBytesUsed();
+
+// Heap allocations through global operator new, total and during the last full frame. 0 unless RETRACT_COUNT_ALLOCATIONS
+u64 HeapAllocations();
+u32 LastFrameHeapAllocations();
+
+// Standard allocator over the frame arenas, deallocate is a no-op
+template<typename T>
+struct FrameAllocator
+{
+    using value_type = T;
+
+    FrameAllocator() = default;
+    template<typename U>
+    constexpr FrameAllocator(const FrameAllocator<U>&) noexcept
+    {}
+
+    [[nodiscard]] T* allocate(size_t count) { return (T*) FrameAllocate(count * sizeof(T), alignof(T)); }
+    void             deallocate(T*, size_t) noexcept {}
+
+    template<typename U>
+    constexpr bool operator==(const FrameAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+};
+
+template<typename T>
+using frame_vector = std::vector<T, FrameAllocator<T>>;
+using frame_string = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
+
+} // namespace retract::memory
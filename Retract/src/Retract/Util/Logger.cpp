@@ -22,45 +22,298 @@
 // ------------------------------------------------------------------------------
 
 #include "Logger.h"
-//#include <cstdio>
+#include "Profiler.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstring>
 #include <ctime>
-#include <iomanip>
-#include <sstream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <Windows.h>
+#endif
 
-namespace retract::logger::detail
+namespace retract::logger
 {
 
 namespace
 {
-std::string CurrentTimeStamp()
+// Must be a power of two. When the ring is full new messages are dropped and counted, producers never wait
+constexpr u64 ring_size = 4096;
+
+// Bounded MPMC queue (Vyukov). A slot's sequence says whose turn it is: equal to the position when it
+// is free for that producer, position + 1 once the message is published for the consumer
+struct alignas(64) Slot
+{
+    std::atomic<u64> sequence{};
+    i64              time_ms{};
+    u32              thread{};
+    LogLevel         level{};
+    u16              length{};
+    char             text[detail::max_message]{};
+};
+
+alignas(64) std::atomic<u64> enqueue_pos{ 0 };
+alignas(64) u64 dequeue_pos{ 0 };
+std::atomic<u64> dropped{ 0 };
+
+std::vector<scope<Sink>> sinks{};
+std::mutex               drain_mutex{};
+std::thread              flush_thread{};
+std::atomic<bool>        running{ false };
+std::atomic<u32>         thread_count{ 0 };
+
+constexpr auto idle_sleep = std::chrono::milliseconds{ 1 };
+
+u32 ThreadIndex()
+{
+    thread_local const u32 index = thread_count.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+// Set up on first use so logging works before Initialize and during static init
+Slot* Slots()
+{
+    static Slot       ring[ring_size]{};
+    static const bool initialized = [] {
+        for (u64 i = 0; i < ring_size; ++i)
+        {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        return true;
+    }();
+    (void) initialized;
+    return ring;
+}
+
+bool Enqueue(LogLevel lvl, std::string_view msg)
 {
-    const auto         t  = std::time(nullptr);
-    const auto         tm = *std::localtime(&t); // NOTE: Not thread safe
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%H:%M:%S");
-    return oss.str();
+    Slot* ring = Slots();
+    u64   pos  = enqueue_pos.load(std::memory_order_relaxed);
+    Slot* slot{};
+    while (true)
+    {
+        slot            = &ring[pos & (ring_size - 1)];
+        const u64 seq   = slot->sequence.load(std::memory_order_acquire);
+        const i64 delta = (i64) seq - (i64) pos;
+        if (delta == 0)
+        {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (delta < 0)
+        {
+            return false;
+        } else
+        {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    slot->time_ms  = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    slot->thread   = ThreadIndex();
+    slot->level    = lvl;
+    slot->length   = (u16) std::min<size_t>(msg.size(), detail::max_message);
+    memcpy(slot->text, msg.data(), slot->length);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+std::string FormatLine(const Slot& slot)
+{
+    const std::time_t seconds = (std::time_t) (slot.time_ms / 1000);
+    std::tm           tm{};
+#ifdef _WIN32
+    localtime_s(&tm, &seconds);
+#else
+    localtime_r(&seconds, &tm);
+#endif
+
+    const char* label = "";
+    switch (slot.level)
+    {
+    case LogLevel::trace: label = "  TRACE  "; break;
+    case LogLevel::debug: label = "  DEBUG  "; break;
+    case LogLevel::info: label = "  INFO   "; break;
+    case LogLevel::warn: label = " WARNING "; break;
+    case LogLevel::error: label = "  ERROR  "; break;
+    case LogLevel::fatal: label = "  FATAL  "; break;
+    }
+
+    return std::format("[{:02}:{:02}:{:02}.{:03}][{}][T{}]: {}\n", tm.tm_hour, tm.tm_min, tm.tm_sec, slot.time_ms % 1000, label,
+                       slot.thread, std::string_view{ slot.text, slot.length });
+}
+
+void WriteLine(LogLevel lvl, std::string_view line)
+{
+    if (sinks.empty())
+    {
+        // Before Initialize or after Shutdown
+        static ConsoleSink console{};
+        console.Write(lvl, line);
+        return;
+    }
+
+    for (const auto& sink : sinks)
+    {
+        sink->Write(lvl, line);
+    }
+}
+
+// Single consumer, whoever holds drain_mutex. Returns the number of messages written
+u32 Drain()
+{
+    std::lock_guard lock{ drain_mutex };
+
+    Slot* ring    = Slots();
+    u32   written = 0;
+    while (true)
+    {
+        Slot&     slot = ring[dequeue_pos & (ring_size - 1)];
+        const u64 seq  = slot.sequence.load(std::memory_order_acquire);
+        if (seq != dequeue_pos + 1)
+            break;
+
+        WriteLine(slot.level, FormatLine(slot));
+        slot.sequence.store(dequeue_pos + ring_size, std::memory_order_release);
+        ++dequeue_pos;
+        ++written;
+    }
+
+    if (const u64 lost = dropped.exchange(0, std::memory_order_relaxed); lost > 0)
+    {
+        WriteLine(LogLevel::warn, std::format("[ WARNING ]: Log ring was full, {} messages were dropped\n", lost));
+    }
+
+    if (written > 0)
+    {
+        for (const auto& sink : sinks)
+        {
+            sink->Flush();
+        }
+    }
+
+    return written;
+}
+
+void FlushLoop()
+{
+    profiler::SetThreadName("Logger");
+    while (running.load(std::memory_order_acquire))
+    {
+        if (Drain() == 0)
+        {
+            std::this_thread::sleep_for(idle_sleep);
+        }
+    }
 }
 } // anonymous namespace
 
-void Output(LogLevel lvl, std::string_view msg)
+void ConsoleSink::Write(LogLevel lvl, std::string_view line)
 {
-    std::string str;
-    std::string time_stamp = CurrentTimeStamp();
-    switch (lvl)
+    fwrite(line.data(), 1, line.size(), lvl >= LogLevel::warn ? stderr : stdout);
+}
+
+void ConsoleSink::Flush()
+{
+    fflush(stdout);
+}
+
+FileSink::FileSink(const std::string& filename)
+{
+    mFile = fopen(filename.c_str(), "w");
+}
+
+FileSink::~FileSink()
+{
+    if (mFile)
     {
-    case LogLevel::trace: str = std::format("[{}][  TRACE  ]: {}\n", time_stamp, msg); break;
-    case LogLevel::debug: str = std::format("[{}][  DEBUG  ]: {}\n", time_stamp, msg); break;
-    case LogLevel::info: str = std::format("[{}][  INFO   ]: {}\n", time_stamp, msg); break;
-    case LogLevel::warn: str = std::format("[{}][ WARNING ]: {}\n", time_stamp, msg); break;
-    case LogLevel::error: str = std::format("[{}][  ERROR  ]: {}\n", time_stamp, msg); break;
-    case LogLevel::fatal: str = std::format("[{}][  FATAL  ]: {}\n", time_stamp, msg); break;
+        fclose(mFile);
     }
+}
 
-    OutputDebugStringA(str.c_str());
+void FileSink::Write(LogLevel lvl, std::string_view line)
+{
+    if (mFile)
+    {
+        fwrite(line.data(), 1, line.size(), mFile);
+    }
+}
+
+void FileSink::Flush()
+{
+    if (mFile)
+    {
+        fflush(mFile);
+    }
+}
 
-    //printf("%s", str.c_str());
+#ifdef _WIN32
+void DebuggerSink::Write(LogLevel lvl, std::string_view line)
+{
+    // Lines from FormatLine are null terminated std::strings
+    OutputDebugStringA(line.data());
 }
-} // namespace retract::logger::detail
\ No newline at end of file
+#endif
+
+void Initialize()
+{
+    if (running)
+        return;
+
+    Drain();
+    sinks.emplace_back(CreateScope<ConsoleSink>());
+#ifdef _WIN32
+    sinks.emplace_back(CreateScope<DebuggerSink>());
+#endif
+
+    running      = true;
+    flush_thread = std::thread{ FlushLoop };
+}
+
+void Shutdown()
+{
+    if (!running)
+        return;
+
+    running = false;
+    flush_thread.join();
+
+    Drain();
+    sinks.clear();
+}
+
+void AddSink(scope<Sink> sink)
+{
+    assert(!running);
+    sinks.emplace_back(std::move(sink));
+}
+
+void Flush()
+{
+    Drain();
+}
+
+namespace detail
+{
+void Output(LogLevel lvl, std::string_view msg)
+{
+    if (!Enqueue(lvl, msg))
+    {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Nothing is going to pick it up, or the process may be about to go down
+    if (!running || lvl == LogLevel::fatal)
+    {
+        Drain();
+    }
+}
+} // namespace detail
+
+} // namespace retract::logger
@@ -24,12 +24,31 @@
 
 #include "Retract/Types.h"
 
+#include <cstdio>
 #include <format>
+#include <string>
+
+// Lowest level that is compiled in, calls below it expand to nothing. Release builds keep errors and fatals by default
+#define RETRACT_LOG_LEVEL_TRACE 0
+#define RETRACT_LOG_LEVEL_DEBUG 1
+#define RETRACT_LOG_LEVEL_INFO  2
+#define RETRACT_LOG_LEVEL_WARN  3
+#define RETRACT_LOG_LEVEL_ERROR 4
+#define RETRACT_LOG_LEVEL_FATAL 5
+#define RETRACT_LOG_LEVEL_OFF   6
+
+#ifndef RETRACT_LOG_LEVEL
+    #ifdef _DEBUG
+        #define RETRACT_LOG_LEVEL RETRACT_LOG_LEVEL_TRACE
+    #else
+        #define RETRACT_LOG_LEVEL RETRACT_LOG_LEVEL_ERROR
+    #endif
+#endif
 
 namespace retract::logger
 {
 
-enum class LogLevel
+enum class LogLevel : u8
 {
     trace,
     debug,
@@ -39,25 +58,105 @@ enum class LogLevel
     fatal
 };
 
+// Receives finished lines on the flush thread, one at a time
+class Sink
+{
+public:
+    virtual ~Sink() = default;
+
+    virtual void Write(LogLevel lvl, std::string_view line) = 0;
+    virtual void Flush() {}
+};
+
+// stdout, warnings and up go to stderr
+class ConsoleSink : public Sink
+{
+public:
+    void Write(LogLevel lvl, std::string_view line) override;
+    void Flush() override;
+};
+
+class FileSink : public Sink
+{
+public:
+    explicit FileSink(const std::string& filename);
+    ~FileSink() override;
+
+    void Write(LogLevel lvl, std::string_view line) override;
+    void Flush() override;
+
+    [[nodiscard]] bool IsOpen() const { return mFile != nullptr; }
+
+private:
+    FILE* mFile{};
+};
+
+#ifdef _WIN32
+// Visual Studio's output window
+class DebuggerSink : public Sink
+{
+public:
+    void Write(LogLevel lvl, std::string_view line) override;
+};
+#endif
+
+// Messages are formatted and timestamped on the calling thread and pushed into a lock free ring, a background
+// thread hands them to the sinks. The console (and the debugger on Windows) always get them. Before Initialize and
+// after Shutdown lines are written to the console synchronously
+void Initialize();
+void Shutdown();
+
+// Extra sinks, only before Initialize
+void AddSink(scope<Sink> sink);
+
+// Blocks until everything logged so far has reached the sinks
+void Flush();
+
 namespace detail
 {
+// Longer messages are cut off
+constexpr u32 max_message = 480;
+
 void Output(LogLevel lvl, std::string_view msg);
-}
 
+template<typename... Args>
+void Log(LogLevel lvl, std::format_string<Args...> fmt, Args&&... args)
+{
+    char       buffer[max_message];
+    const auto result = std::format_to_n(buffer, max_message, fmt, std::forward<Args>(args)...);
+    Output(lvl, std::string_view{ buffer, (size_t) (result.out - buffer) });
 }
+} // namespace detail
 
-#ifdef _DEBUG
-    #define LOG_TRACE(msg, ...) retract::logger::detail::Output(retract::logger::LogLevel::trace, std::format(msg, ##__VA_ARGS__))
-    #define LOG_DEBUG(msg, ...) retract::logger::detail::Output(retract::logger::LogLevel::debug, std::format(msg, ##__VA_ARGS__))
-    #define LOG_INFO(msg, ...)  retract::logger::detail::Output(retract::logger::LogLevel::info, std::format(msg, ##__VA_ARGS__))
-    #define LOG_WARN(msg, ...)  retract::logger::detail::Output(retract::logger::LogLevel::warn, std::format(msg, ##__VA_ARGS__))
-    #define LOG_ERROR(msg, ...) retract::logger::detail::Output(retract::logger::LogLevel::error, std::format(msg, ##__VA_ARGS__))
-    #define LOG_FATAL(msg, ...) retract::logger::detail::Output(retract::logger::LogLevel::fatal, std::format(msg, ##__VA_ARGS__))
+} // namespace retract::logger
+
+#if RETRACT_LOG_LEVEL <= RETRACT_LOG_LEVEL_TRACE
+    #define LOG_TRACE(msg, ...) retract::logger::detail::Log(retract::logger::LogLevel::trace, msg, ##__VA_ARGS__)
 #else
     #define LOG_TRACE(msg, ...)
+#endif
+#if RETRACT_LOG_LEVEL <= RETRACT_LOG_LEVEL_DEBUG
+    #define LOG_DEBUG(msg, ...) retract::logger::detail::Log(retract::logger::LogLevel::debug, msg, ##__VA_ARGS__)
+#else
     #define LOG_DEBUG(msg, ...)
+#endif
+#if RETRACT_LOG_LEVEL <= RETRACT_LOG_LEVEL_INFO
+    #define LOG_INFO(msg, ...) retract::logger::detail::Log(retract::logger::LogLevel::info, msg, ##__VA_ARGS__)
+#else
     #define LOG_INFO(msg, ...)
+#endif
+#if RETRACT_LOG_LEVEL <= RETRACT_LOG_LEVEL_WARN
+    #define LOG_WARN(msg, ...) retract::logger::detail::Log(retract::logger::LogLevel::warn, msg, ##__VA_ARGS__)
+#else
     #define LOG_WARN(msg, ...)
+#endif
+#if RETRACT_LOG_LEVEL <= RETRACT_LOG_LEVEL_ERROR
+    #define LOG_ERROR(msg, ...) retract::logger::detail::Log(retract::logger::LogLevel::error, msg, ##__VA_ARGS__)
+#else
     #define LOG_ERROR(msg, ...)
+#endif
+#if RETRACT_LOG_LEVEL <= RETRACT_LOG_LEVEL_FATAL
+    #define LOG_FATAL(msg, ...) retract::logger::detail::Log(retract::logger::LogLevel::fatal, msg, ##__VA_ARGS__)
+#else
     #define LOG_FATAL(msg, ...)
 #endif
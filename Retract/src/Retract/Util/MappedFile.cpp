@@ -0,0 +1,136 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MappedFile.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace retract
+{
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& filename)
+{
+    Close();
+
+    mFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (mFile == INVALID_HANDLE_VALUE)
+    {
+        mFile = nullptr;
+        return false;
+    }
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(mFile, &size) || size.QuadPart == 0)
+    {
+        Close();
+        return false;
+    }
+
+    mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mMapping)
+    {
+        Close();
+        return false;
+    }
+
+    mData = MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+    if (!mData)
+    {
+        Close();
+        return false;
+    }
+
+    mSize = (u64) size.QuadPart;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (mData)
+        UnmapViewOfFile(mData);
+    if (mMapping)
+        CloseHandle(mMapping);
+    if (mFile)
+        CloseHandle(mFile);
+
+    mData    = nullptr;
+    mMapping = nullptr;
+    mFile    = nullptr;
+    mSize    = 0;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& filename)
+{
+    Close();
+
+    mFile = open(filename.c_str(), O_RDONLY);
+    if (mFile < 0)
+        return false;
+
+    struct stat info{};
+    if (fstat(mFile, &info) != 0 || info.st_size == 0)
+    {
+        Close();
+        return false;
+    }
+
+    void* data = mmap(nullptr, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, mFile, 0);
+    if (data == MAP_FAILED)
+    {
+        Close();
+        return false;
+    }
+
+    mData = data;
+    mSize = (u64) info.st_size;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (mData)
+        munmap(const_cast<void*>(mData), (size_t) mSize);
+    if (mFile >= 0)
+        close(mFile);
+
+    mData = nullptr;
+    mFile = -1;
+    mSize = 0;
+}
+
+#endif
+
+} // namespace retract
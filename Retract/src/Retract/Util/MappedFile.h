@@ -0,0 +1,60 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MappedFile.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma once
+
+#include "Retract/Common.h"
+
+namespace retract
+{
+
+// Read only view of a whole file, backed by the OS page cache instead of a heap copy
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& filename) { Open(filename); }
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& filename);
+    void Close();
+
+    constexpr bool        IsOpen() const { return mData != nullptr; }
+    constexpr const void* Data() const { return mData; }
+    constexpr u64         Size() const { return mSize; }
+
+private:
+    const void* mData{};
+    u64         mSize{};
+#ifdef _WIN32
+    void* mFile{};
+    void* mMapping{};
+#else
+    i32 mFile{ -1 };
+#endif
+};
+
+} // namespace retract
@@ -50,16 +50,40 @@ Vector4 Slerp(const Vector4& a, const Vector4& b, f32 f)
         scale1 = -scale1;
 
     vec4 ret{};
+#if RETRACT_SIMD_SSE
+    const __m128 blend = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(scale0), _mm_load_ps(&a.x)), _mm_mul_ps(_mm_set1_ps(scale1), _mm_load_ps(&b.x)));
+    _mm_store_ps(&ret.x, blend);
+#else
     ret.x = scale0 * a.x + scale1 * b.x;
     ret.y = scale0 * a.y + scale1 * b.y;
     ret.z = scale0 * a.z + scale1 * b.z;
     ret.w = scale0 * a.w + scale1 * b.w;
+#endif
     return ret.Normalize();
 }
 
 Vector4 Concatinate(const Vector4& q, const Vector4& p)
 {
-    vec4       ret{};
+    vec4 ret{};
+#if RETRACT_SIMD_SSE
+    // Hamilton product p * q, one broadcast component of p against a signed shuffle of q per line
+    const __m128 pv = _mm_load_ps(&p.x);
+    const __m128 qv = _mm_load_ps(&q.x);
+
+    const __m128 q_wzyx = _mm_shuffle_ps(qv, qv, _MM_SHUFFLE(0, 1, 2, 3));
+    const __m128 q_zwxy = _mm_shuffle_ps(qv, qv, _MM_SHUFFLE(1, 0, 3, 2));
+    const __m128 q_yxwz = _mm_shuffle_ps(qv, qv, _MM_SHUFFLE(2, 3, 0, 1));
+
+    const __m128 sign_x = _mm_set_ps(-0.f, 0.f, -0.f, 0.f);
+    const __m128 sign_y = _mm_set_ps(-0.f, -0.f, 0.f, 0.f);
+    const __m128 sign_z = _mm_set_ps(-0.f, 0.f, 0.f, -0.f);
+
+    __m128 r = _mm_mul_ps(_mm_shuffle_ps(pv, pv, _MM_SHUFFLE(3, 3, 3, 3)), qv);
+    r        = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(pv, pv, _MM_SHUFFLE(0, 0, 0, 0)), _mm_xor_ps(q_wzyx, sign_x)));
+    r        = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(pv, pv, _MM_SHUFFLE(1, 1, 1, 1)), _mm_xor_ps(q_zwxy, sign_y)));
+    r        = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(pv, pv, _MM_SHUFFLE(2, 2, 2, 2)), _mm_xor_ps(q_yxwz, sign_z)));
+    _mm_store_ps(&ret.x, r);
+#else
     const vec3 qv{ q.x, q.y, q.z };
     const vec3 pv{ p.x, p.y, p.z };
     const vec3 new_vec = p.w * qv + q.w * pv + Cross(pv, qv);
@@ -68,6 +92,7 @@ Vector4 Concatinate(const Vector4& q, const Vector4& p)
     ret.z              = new_vec.z;
 
     ret.w = p.w * q.w - Dot(pv, qv);
+#endif
 
     return ret;
 }
@@ -82,11 +107,39 @@ Vector2 Transform(const Vector2& vec, const Matrix3& mat, f32 w)
 
 Vector3 Transform(const Vector3& vec, const Matrix4& mat, f32 w)
 {
+#if RETRACT_SIMD_SSE
+    alignas(16) f32 out[4];
+    __m128          r = _mm_mul_ps(_mm_set1_ps(vec.x), _mm_load_ps(mat.mat[0]));
+    r                 = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(vec.y), _mm_load_ps(mat.mat[1])));
+    r                 = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(vec.z), _mm_load_ps(mat.mat[2])));
+    r                 = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(w), _mm_load_ps(mat.mat[3])));
+    _mm_store_ps(out, r);
+    return { out[0], out[1], out[2] };
+#else
     Vector3 ret;
     ret.x = vec.x * mat.mat[0][0] + vec.y * mat.mat[1][0] + vec.z * mat.mat[2][0] + w * mat.mat[3][0];
     ret.y = vec.x * mat.mat[0][1] + vec.y * mat.mat[1][1] + vec.z * mat.mat[2][1] + w * mat.mat[3][1];
     ret.z = vec.x * mat.mat[0][2] + vec.y * mat.mat[1][2] + vec.z * mat.mat[2][2] + w * mat.mat[3][2];
     return ret;
+#endif
+}
+
+Vector4 Transform(const Vector4& vec, const Matrix4& mat)
+{
+    Vector4 ret;
+#if RETRACT_SIMD_SSE
+    __m128 r = _mm_mul_ps(_mm_set1_ps(vec.x), _mm_load_ps(mat.mat[0]));
+    r        = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(vec.y), _mm_load_ps(mat.mat[1])));
+    r        = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(vec.z), _mm_load_ps(mat.mat[2])));
+    r        = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(vec.w), _mm_load_ps(mat.mat[3])));
+    _mm_store_ps(&ret.x, r);
+#else
+    ret.x = vec.x * mat.mat[0][0] + vec.y * mat.mat[1][0] + vec.z * mat.mat[2][0] + vec.w * mat.mat[3][0];
+    ret.y = vec.x * mat.mat[0][1] + vec.y * mat.mat[1][1] + vec.z * mat.mat[2][1] + vec.w * mat.mat[3][1];
+    ret.z = vec.x * mat.mat[0][2] + vec.y * mat.mat[1][2] + vec.z * mat.mat[2][2] + vec.w * mat.mat[3][2];
+    ret.w = vec.x * mat.mat[0][3] + vec.y * mat.mat[1][3] + vec.z * mat.mat[2][3] + vec.w * mat.mat[3][3];
+#endif
+    return ret;
 }
 
 Vector3 Transform(const Vector3& vec, const Vector4& quaternion)
@@ -114,6 +167,92 @@ Vector3 TransformWithPerspDiv(const Vector3& vec, const Matrix4& mat, f32 w)
 
 void Matrix4::Invert()
 {
+#if RETRACT_SIMD_SSE
+    // Cramer's rule, same cofactor expansion as the scalar path below but four cofactors at a time
+    // (Intel AP-928, "Streaming SIMD Extensions - Inverse of 4x4 Matrix")
+    f32* src = &mat[0][0];
+
+    __m128 tmp  = _mm_setzero_ps();
+    __m128 row0 = _mm_setzero_ps();
+    __m128 row1 = _mm_setzero_ps();
+    __m128 row2 = _mm_setzero_ps();
+    __m128 row3 = _mm_setzero_ps();
+
+    // Load and transpose
+    tmp  = _mm_loadh_pi(_mm_loadl_pi(tmp, (const __m64*) (src)), (const __m64*) (src + 4));
+    row1 = _mm_loadh_pi(_mm_loadl_pi(row1, (const __m64*) (src + 8)), (const __m64*) (src + 12));
+    row0 = _mm_shuffle_ps(tmp, row1, 0x88);
+    row1 = _mm_shuffle_ps(row1, tmp, 0xDD);
+    tmp  = _mm_loadh_pi(_mm_loadl_pi(tmp, (const __m64*) (src + 2)), (const __m64*) (src + 6));
+    row3 = _mm_loadh_pi(_mm_loadl_pi(row3, (const __m64*) (src + 10)), (const __m64*) (src + 14));
+    row2 = _mm_shuffle_ps(tmp, row3, 0x88);
+    row3 = _mm_shuffle_ps(row3, tmp, 0xDD);
+
+    // Cofactors
+    tmp           = _mm_mul_ps(row2, row3);
+    tmp           = _mm_shuffle_ps(tmp, tmp, 0xB1);
+    __m128 minor0 = _mm_mul_ps(row1, tmp);
+    __m128 minor1 = _mm_mul_ps(row0, tmp);
+    tmp           = _mm_shuffle_ps(tmp, tmp, 0x4E);
+    minor0        = _mm_sub_ps(_mm_mul_ps(row1, tmp), minor0);
+    minor1        = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor1);
+    minor1        = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+    tmp           = _mm_mul_ps(row1, row2);
+    tmp           = _mm_shuffle_ps(tmp, tmp, 0xB1);
+    minor0        = _mm_add_ps(_mm_mul_ps(row3, tmp), minor0);
+    __m128 minor3 = _mm_mul_ps(row0, tmp);
+    tmp           = _mm_shuffle_ps(tmp, tmp, 0x4E);
+    minor0        = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp));
+    minor3        = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor3);
+    minor3        = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+    tmp           = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+    tmp           = _mm_shuffle_ps(tmp, tmp, 0xB1);
+    row2          = _mm_shuffle_ps(row2, row2, 0x4E);
+    minor0        = _mm_add_ps(_mm_mul_ps(row2, tmp), minor0);
+    __m128 minor2 = _mm_mul_ps(row0, tmp);
+    tmp           = _mm_shuffle_ps(tmp, tmp, 0x4E);
+    minor0        = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp));
+    minor2        = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor2);
+    minor2        = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+    tmp    = _mm_mul_ps(row0, row1);
+    tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+    minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor2);
+    minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp), minor3);
+    tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+    minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp), minor2);
+    minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp));
+
+    tmp    = _mm_mul_ps(row0, row3);
+    tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+    minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp));
+    minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor2);
+    tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+    minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor1);
+    minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp));
+
+    tmp    = _mm_mul_ps(row0, row2);
+    tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+    minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor1);
+    minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp));
+    tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+    minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp));
+    minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor3);
+
+    // Determinant, full precision divide rather than the rcp estimate from the paper
+    __m128 det = _mm_mul_ps(row0, minor0);
+    det        = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+    det        = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+    det        = _mm_div_ss(_mm_set_ss(1.f), det);
+    det        = _mm_shuffle_ps(det, det, 0x00);
+
+    _mm_store_ps(mat[0], _mm_mul_ps(det, minor0));
+    _mm_store_ps(mat[1], _mm_mul_ps(det, minor1));
+    _mm_store_ps(mat[2], _mm_mul_ps(det, minor2));
+    _mm_store_ps(mat[3], _mm_mul_ps(det, minor3));
+#else
     f32 tmp[12];
     f32 src[16];
     f32 dst[16];
@@ -222,6 +361,32 @@ void Matrix4::Invert()
             mat[i][j] = dst[i * 4 + j];
         }
     }
+#endif
+}
+
+void Matrix4::Transpose()
+{
+#if RETRACT_SIMD_SSE
+    __m128 row0 = _mm_load_ps(mat[0]);
+    __m128 row1 = _mm_load_ps(mat[1]);
+    __m128 row2 = _mm_load_ps(mat[2]);
+    __m128 row3 = _mm_load_ps(mat[3]);
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+    _mm_store_ps(mat[0], row0);
+    _mm_store_ps(mat[1], row1);
+    _mm_store_ps(mat[2], row2);
+    _mm_store_ps(mat[3], row3);
+#else
+    for (i32 i = 0; i < 4; i++)
+    {
+        for (i32 j = i + 1; j < 4; j++)
+        {
+            const f32 tmp = mat[i][j];
+            mat[i][j]     = mat[j][i];
+            mat[j][i]     = tmp;
+        }
+    }
+#endif
 }
 
 Matrix4 FromQuaternion(const Quaternion& quat)
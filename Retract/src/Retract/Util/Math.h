@@ -25,6 +25,21 @@
 #include "Retract/Types.h"
 #include <cmath>
 #include <limits>
+#include <type_traits>
+
+// Picked at compile time, define RETRACT_NO_SIMD to force the scalar paths
+#if !defined(RETRACT_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define RETRACT_SIMD_SSE 1
+    #include <immintrin.h>
+#else
+    #define RETRACT_SIMD_SSE 0
+#endif
+
+#if RETRACT_SIMD_SSE && defined(__AVX__)
+    #define RETRACT_SIMD_AVX 1
+#else
+    #define RETRACT_SIMD_AVX 0
+#endif
 
 namespace retract::math
 {
@@ -74,14 +89,20 @@ constexpr bool NearZero(f32 val, f32 tolerance = epsilon)
     return Abs(val) <= tolerance;
 }
 
-constexpr f32 SqrtNewton(f32 x, f32 current, f32 previous)
+// Newton's method in double until the estimate stops changing, exact to the float it is rounded to at any scale
+constexpr f64 SqrtNewton(f64 x, f64 current, f64 previous)
 {
-    return NearEqual(current, previous) ? current : SqrtNewton(x, 0.5f * (current + x / current), current);
+    return current == previous ? current : SqrtNewton(x, 0.5 * (current + x / current), current);
 }
 
+// std::sqrt at run time, the constexpr fallback only runs in constant expressions
 constexpr f32 Sqrt(f32 x)
 {
-    return x >= 0 && x < infinity ? SqrtNewton(x, x, 0.f) : nan;
+    if (!std::is_constant_evaluated())
+    {
+        return std::sqrt(x);
+    }
+    return x >= 0 && x < infinity ? (f32) SqrtNewton(x, x, 0.0) : nan;
 }
 
 constexpr f32 ToRadians(f32 degrees)
@@ -342,7 +363,7 @@ public:
     }
 };
 
-class Vector4
+class alignas(16) Vector4
 {
 public:
     // clang-format off
@@ -373,7 +394,7 @@ public:
 
     friend Vector4 operator*(const Vector4& a, const Vector4& b) { return { a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w }; }
 
-    friend Vector4 operator/(const Vector4& a, const Vector4& b) { return { a.x / b.x, a.y / b.y, a.x / b.x, a.w / b.w }; }
+    friend Vector4 operator/(const Vector4& a, const Vector4& b) { return { a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w }; }
 
     friend Vector4 operator*(const Vector4& v, f32 scalar) { return { v.x * scalar, v.y * scalar, v.z * scalar, v.w * scalar }; }
 
@@ -459,11 +480,20 @@ public:
 
     Vector4& Normalize()
     {
-        const f32 len = Length();
+#if RETRACT_SIMD_SSE
+        __m128       v   = _mm_load_ps(&x);
+        const __m128 sq  = _mm_mul_ps(v, v);
+        __m128       sum = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+        sum              = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+        v                = _mm_div_ps(v, _mm_sqrt_ps(sum));
+        _mm_store_ps(&x, v);
+#else
+        const f32 len = std::sqrt(LengthSq());
         x /= len;
         y /= len;
         z /= len;
-        z /= len;
+        w /= len;
+#endif
         return *this;
     }
 
@@ -481,6 +511,7 @@ Vector2 Transform(const Vector2& vec, const class Matrix3& mat, f32 w = 1.f);
 Vector3 Transform(const Vector3& vec, const class Matrix4& mat, f32 w = 1.f);
 Vector3 Transform(const Vector3& vec, const Vector4& quaternion);
 Vector3 TransformWithPerspDiv(const Vector3& vec, const Matrix4& mat, f32 w = 1.f);
+Vector4 Transform(const Vector4& vec, const Matrix4& mat);
 
 
 inline Vector2 Normalize(const Vector2& v)
@@ -609,7 +640,7 @@ public:
     }
 };
 
-class Matrix4
+class alignas(16) Matrix4
 {
 public:
     f32 mat[4][4]{
@@ -628,6 +659,36 @@ public:
     friend Matrix4 operator*(const Matrix4& left, const Matrix4& right)
     {
         Matrix4 ret;
+#if RETRACT_SIMD_AVX
+        // Two result rows per iteration, each row is a linear combination of the rows of right
+        const __m256 r0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right.mat[0]));
+        const __m256 r1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right.mat[1]));
+        const __m256 r2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right.mat[2]));
+        const __m256 r3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(right.mat[3]));
+        for (u32 i = 0; i < 4; i += 2)
+        {
+            const __m256 l   = _mm256_loadu_ps(left.mat[i]);
+            __m256       row = _mm256_mul_ps(_mm256_shuffle_ps(l, l, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+            row              = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(l, l, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+            row              = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(l, l, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+            row              = _mm256_add_ps(row, _mm256_mul_ps(_mm256_shuffle_ps(l, l, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+            _mm256_storeu_ps(ret.mat[i], row);
+        }
+#elif RETRACT_SIMD_SSE
+        // Each result row is a linear combination of the rows of right
+        const __m128 r0 = _mm_load_ps(right.mat[0]);
+        const __m128 r1 = _mm_load_ps(right.mat[1]);
+        const __m128 r2 = _mm_load_ps(right.mat[2]);
+        const __m128 r3 = _mm_load_ps(right.mat[3]);
+        for (u32 i = 0; i < 4; ++i)
+        {
+            __m128 row = _mm_mul_ps(_mm_set1_ps(left.mat[i][0]), r0);
+            row        = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(left.mat[i][1]), r1));
+            row        = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(left.mat[i][2]), r2));
+            row        = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(left.mat[i][3]), r3));
+            _mm_store_ps(ret.mat[i], row);
+        }
+#else
         // row 0
         ret.mat[0][0] = left.mat[0][0] * right.mat[0][0] + left.mat[0][1] * right.mat[1][0] + left.mat[0][2] * right.mat[2][0] +
                         left.mat[0][3] * right.mat[3][0];
@@ -679,6 +740,7 @@ public:
 
         ret.mat[3][3] = left.mat[3][0] * right.mat[0][3] + left.mat[3][1] * right.mat[1][3] + left.mat[3][2] * right.mat[2][3] +
                         left.mat[3][3] * right.mat[3][3];
+#endif
 
         return ret;
     }
@@ -689,8 +751,8 @@ public:
         return *this;
     }
 
-    // Not in SIMD, slow af
     void Invert();
+    void Transpose();
 
     [[nodiscard]] Vector3 Translation() const { return { mat[3][0], mat[3][1], mat[3][2] }; }
     [[nodiscard]] Vector3 XAxis() const { return Normalize({ mat[0][0], mat[0][1], mat[0][2] }); } // X / Forward axis
@@ -820,6 +882,13 @@ inline Matrix4 Translation(const Vector3& trans)
     return { mat };
 }
 
+inline Matrix4 Transpose(const Matrix4& mat)
+{
+    Matrix4 ret = mat;
+    ret.Transpose();
+    return ret;
+}
+
 using Quaternion = Vector4;
 
 Matrix4 FromQuaternion(const Quaternion& quat);
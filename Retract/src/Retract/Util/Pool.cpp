@@ -0,0 +1,146 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Pool.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#include "Pool.h"
+
+#include <cassert>
+
+namespace retract::memory
+{
+
+namespace
+{
+// In front of every object from AllocateObject. Sized to keep the object at object_alignment
+struct alignas(object_alignment) ObjectHeader
+{
+    u32 size_class;
+};
+
+constexpr u32 header_size       = sizeof(ObjectHeader);
+constexpr u32 size_class_step   = 64;
+constexpr u32 size_class_count  = max_pooled_size / size_class_step;
+constexpr u32 heap_class        = u32_invalid_id;
+constexpr u32 objects_per_chunk = 256;
+
+// Built on first use so entities made during static initialization still find them
+BlockPool& SizeClass(u32 index)
+{
+    static BlockPool* pools = [] {
+        // Deliberately never destroyed, entities owned by statics may be freed after this file's statics are gone
+        auto* storage = (BlockPool*) ::operator new(sizeof(BlockPool) * size_class_count);
+        for (u32 i = 0; i < size_class_count; ++i)
+        {
+            new (storage + i) BlockPool{ header_size + (i + 1) * size_class_step, objects_per_chunk };
+        }
+        return storage;
+    }();
+
+    return pools[index];
+}
+} // anonymous namespace
+
+BlockPool::BlockPool(u32 block_size, u32 blocks_per_chunk) :
+    mBlockSize{ (u32) ((block_size + object_alignment - 1) & ~(object_alignment - 1)) },
+    mBlocksPerChunk{ blocks_per_chunk }
+{
+    assert(mBlockSize >= sizeof(FreeBlock) && mBlocksPerChunk > 0);
+}
+
+BlockPool::~BlockPool()
+{
+    for (u8* chunk : mChunks)
+    {
+        ::operator delete(chunk, std::align_val_t{ object_alignment });
+    }
+}
+
+void* BlockPool::Allocate()
+{
+    if (!mFree)
+    {
+        Grow();
+    }
+
+    FreeBlock* block = mFree;
+    mFree            = block->next;
+    ++mLive;
+    return block;
+}
+
+void BlockPool::Free(void* block)
+{
+    assert(block && mLive > 0);
+    auto* free_block = (FreeBlock*) block;
+    free_block->next = mFree;
+    mFree            = free_block;
+    --mLive;
+}
+
+void BlockPool::Grow()
+{
+    u8* chunk = (u8*) ::operator new((size_t) mBlockSize * mBlocksPerChunk, std::align_val_t{ object_alignment });
+    mChunks.emplace_back(chunk);
+
+    // Threaded back to front so blocks are handed out in address order
+    for (u32 i = mBlocksPerChunk; i > 0; --i)
+    {
+        auto* block = (FreeBlock*) (chunk + (size_t) (i - 1) * mBlockSize);
+        block->next = mFree;
+        mFree       = block;
+    }
+}
+
+void* AllocateObject(size_t size, size_t alignment)
+{
+    assert(alignment <= object_alignment && "Pool allocated types can't be aligned past memory::object_alignment");
+    ObjectHeader* header{};
+    if (size <= max_pooled_size)
+    {
+        const u32 size_class = (u32) (size == 0 ? 0 : (size - 1) / size_class_step);
+        header               = (ObjectHeader*) SizeClass(size_class).Allocate();
+        header->size_class   = size_class;
+    } else
+    {
+        header             = (ObjectHeader*) ::operator new(header_size + size, std::align_val_t{ object_alignment });
+        header->size_class = heap_class;
+    }
+
+    return (u8*) header + header_size;
+}
+
+void FreeObject(void* object)
+{
+    if (!object)
+        return;
+
+    auto* header = (ObjectHeader*) ((u8*) object - header_size);
+    if (header->size_class == heap_class)
+    {
+        ::operator delete(header, std::align_val_t{ object_alignment });
+    } else
+    {
+        SizeClass(header->size_class).Free(header);
+    }
+}
+
+} // namespace retract::memory
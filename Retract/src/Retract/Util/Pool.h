@@ -0,0 +1,104 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Pool.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Types.h"
+#include "Util.h"
+
+#include <cstddef>
+#include <new>
+
+namespace retract::memory
+{
+
+// Alignment of every block and pooled object. At least 16 so classes holding vec4 and mat4 members (alignas(16)) can
+// be pooled, max_align_t only guarantees 8 on some platforms
+constexpr size_t object_alignment = alignof(std::max_align_t) > 16 ? alignof(std::max_align_t) : 16;
+
+// Fixed size blocks carved out of chunks of blocks_per_chunk, each aligned to object_alignment. Freed blocks go on an
+// intrusive free list and are handed out again before a new chunk is made, chunks are only given back by the
+// destructor. Not thread safe
+class BlockPool
+{
+public:
+    BlockPool(u32 block_size, u32 blocks_per_chunk);
+    ~BlockPool();
+
+    BlockPool(const BlockPool&)            = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+    [[nodiscard]] void* Allocate();
+    void                Free(void* block);
+
+    [[nodiscard]] constexpr u32 BlockSize() const { return mBlockSize; }
+    [[nodiscard]] constexpr u32 Live() const { return mLive; }
+    [[nodiscard]] constexpr u32 Capacity() const { return (u32) mChunks.size() * mBlocksPerChunk; }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    void Grow();
+
+    utl::vector<u8*> mChunks{};
+    FreeBlock*       mFree{};
+    u32              mBlockSize{};
+    u32              mBlocksPerChunk{};
+    u32              mLive{};
+};
+
+// Backing for the class operator new/delete of Entity and Component. Objects are served from size classes 64 bytes
+// apart up to max_pooled_size, a small header in front of each remembers where it came from so any derived type can be
+// freed without knowing its size. Anything bigger goes to the heap. Objects are aligned to object_alignment, asking
+// for more asserts. Main thread only, like entity creation
+constexpr u32 max_pooled_size = 1024;
+
+[[nodiscard]] void* AllocateObject(size_t size, size_t alignment = object_alignment);
+void                FreeObject(void* object);
+
+} // namespace retract::memory
+
+// Class operator new/delete sending a hierarchy through memory::AllocateObject. The aligned forms are what new picks for
+// derived types aligned past the default new alignment. The debug build also needs the placement form DBG_NEW expands
+// to, since a class operator new hides the global ones
+#define RETRACT_POOL_ALLOCATED_COMMON                                                                                            \
+    static void* operator new(size_t size) { return retract::memory::AllocateObject(size); }                                     \
+    static void* operator new(size_t size, std::align_val_t align)                                                               \
+    {                                                                                                                            \
+        return retract::memory::AllocateObject(size, (size_t) align);                                                            \
+    }                                                                                                                            \
+    static void  operator delete(void* object) { retract::memory::FreeObject(object); }                                          \
+    static void  operator delete(void* object, std::align_val_t) { retract::memory::FreeObject(object); }
+
+#ifdef _DEBUG
+    #define RETRACT_POOL_ALLOCATED                                                                                               \
+        RETRACT_POOL_ALLOCATED_COMMON                                                                                            \
+        static void* operator new(size_t size, int, const char*, int) { return retract::memory::AllocateObject(size); }          \
+        static void  operator delete(void* object, int, const char*, int) { retract::memory::FreeObject(object); }
+#else
+    #define RETRACT_POOL_ALLOCATED RETRACT_POOL_ALLOCATED_COMMON
+#endif
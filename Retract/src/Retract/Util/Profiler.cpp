@@ -0,0 +1,159 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Profiler.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "Profiler.h"
+#include "Retract/Common.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+namespace retract::profiler
+{
+
+namespace
+{
+// Per track, older zones get overwritten once a track wraps. Must be a power of two
+constexpr u64 ring_capacity = 1u << 15;
+
+struct ZoneRecord
+{
+    const char* name{};
+    u64         start{};
+    u64         end{};
+};
+} // anonymous namespace
+
+struct Track
+{
+    std::string                           name{};
+    u32                                   id{};
+    std::atomic<u64>                      head{ 0 };
+    std::array<ZoneRecord, ring_capacity> zones{};
+};
+
+namespace
+{
+// Tracks are never freed before exit so a thread's zones outlive the thread
+std::mutex                track_mutex{};
+utl::vector<scope<Track>> tracks{};
+thread_local Track*       thread_track{ nullptr };
+
+const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+Track* NewTrack(const char* name)
+{
+    std::lock_guard lock{ track_mutex };
+    auto&           track = tracks.emplace_back(CreateScope<Track>());
+    track->id             = (u32) tracks.size() - 1;
+    track->name           = name ? name : std::format("Thread {}", track->id);
+    return track.get();
+}
+
+Track& ThreadTrack()
+{
+    if (!thread_track)
+    {
+        thread_track = NewTrack(nullptr);
+    }
+    return *thread_track;
+}
+
+// Single writer per track, the release store publishes the record to ExportChromeTrace
+void Push(Track& track, const char* name, u64 start_ns, u64 end_ns)
+{
+    const u64 head                          = track.head.load(std::memory_order_relaxed);
+    track.zones[head & (ring_capacity - 1)] = ZoneRecord{ name, start_ns, end_ns };
+    track.head.store(head + 1, std::memory_order_release);
+}
+} // anonymous namespace
+
+u64 Now()
+{
+    return (u64) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void SetThreadName(const char* name)
+{
+    Track& track = ThreadTrack();
+
+    std::lock_guard lock{ track_mutex };
+    track.name = name;
+}
+
+void Record(const char* name, u64 start_ns, u64 end_ns)
+{
+    Push(ThreadTrack(), name, start_ns, end_ns);
+}
+
+Track* CreateTrack(const char* name)
+{
+    return NewTrack(name);
+}
+
+void Record(Track* track, const char* name, u64 start_ns, u64 end_ns)
+{
+    Push(*track, name, start_ns, end_ns);
+}
+
+bool ExportChromeTrace(const std::string& filename)
+{
+    std::ofstream out{ filename };
+    if (!out)
+    {
+        LOG_ERROR("Failed to open '{}' for the profiler trace", filename);
+        return false;
+    }
+
+    std::lock_guard lock{ track_mutex };
+
+    // Timestamps and durations are in microseconds
+    out << "{\"traceEvents\":[\n";
+    const char* separator = "";
+    u64         count     = 0;
+    for (const auto& track : tracks)
+    {
+        out << std::format("{}{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+                           separator, track->id, track->name);
+        separator = ",\n";
+
+        const u64 head  = track->head.load(std::memory_order_acquire);
+        const u64 first = head > ring_capacity ? head - ring_capacity : 0;
+        for (u64 i = first; i < head; ++i)
+        {
+            const ZoneRecord& zone = track->zones[i & (ring_capacity - 1)];
+            out << std::format(",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", zone.name,
+                               track->id, (f64) zone.start / 1000.0, (f64) (zone.end - zone.start) / 1000.0);
+        }
+        count += head - first;
+    }
+    out << "\n]}\n";
+
+    LOG_INFO("Wrote {} profiler zones to '{}'", count, filename);
+    return true;
+}
+
+} // namespace retract::profiler
@@ -0,0 +1,87 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Profiler.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "Retract/Types.h"
+
+#include <string>
+
+// Zones are compiled in by default, define RETRACT_NO_PROFILE to strip every PROFILE_ macro
+#ifndef RETRACT_NO_PROFILE
+    #define RETRACT_PROFILE 1
+#else
+    #define RETRACT_PROFILE 0
+#endif
+
+namespace retract::profiler
+{
+
+// Nanoseconds since the profiler's epoch
+u64 Now();
+
+// Names the calling thread's track in the exported trace
+void SetThreadName(const char* name);
+
+// Adds a finished zone to the calling thread's ring buffer. Names are stored by pointer, so they have
+// to be string literals (or otherwise live as long as the program)
+void Record(const char* name, u64 start_ns, u64 end_ns);
+
+// Tracks that don't belong to a thread, like the GPU timings. Only one thread may record to a track. The handle stays
+// valid until exit, recording through it never touches the track list other threads add to
+struct Track;
+
+Track* CreateTrack(const char* name);
+void   Record(Track* track, const char* name, u64 start_ns, u64 end_ns);
+
+// Writes the zones still held in every ring as Chrome trace json (chrome://tracing or ui.perfetto.dev).
+// Zones a thread records while this runs may be torn, so call it between frames
+bool ExportChromeTrace(const std::string& filename);
+
+class ScopedZone
+{
+public:
+    explicit ScopedZone(const char* name) : mName{ name }, mStart{ Now() } {}
+    ~ScopedZone() { Record(mName, mStart, Now()); }
+
+    ScopedZone(const ScopedZone&)            = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    const char* mName;
+    u64         mStart;
+};
+
+} // namespace retract::profiler
+
+#define RETRACT_CONCAT_INNER(a, b) a##b
+#define RETRACT_CONCAT(a, b)       RETRACT_CONCAT_INNER(a, b)
+
+#if RETRACT_PROFILE
+    #define PROFILE_SCOPE(name) const retract::profiler::ScopedZone RETRACT_CONCAT(profile_zone_, __LINE__){ name }
+#else
+    #define PROFILE_SCOPE(name)
+#endif
+
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
@@ -1,9 +1,10 @@
 
-#version 330
+#version 430
 
 in vec2 fragTexCoord;
 in vec3 fragNormal;
 in vec3 fragWorldPos;
+flat in float fragSpecularPower;
 
 out vec4 outColor;
 
@@ -16,11 +17,15 @@ struct DirectionalLight
 	vec3 specularColor;
 };
 
-uniform vec3 CameraPos;
-uniform float SpecularPower;
-uniform vec3 AmbientLight;
-
-uniform DirectionalLight DirLight;
+// Shared with every program, filled once per frame by the renderer
+layout(std140, row_major) uniform FrameData
+{
+	mat4 ViewProj;
+	mat4 SpriteViewProj;
+	vec3 CameraPos;
+	vec3 AmbientLight;
+	DirectionalLight DirLight;
+};
 
 void main()
 {
@@ -34,7 +39,7 @@ void main()
 	if (NdotL > 0)
 	{
 		vec3 Diffuse = DirLight.diffuseColor * NdotL;
-		vec3 Specular = DirLight.specularColor * pow(max(0.0, dot(R, V)), SpecularPower);
+		vec3 Specular = DirLight.specularColor * pow(max(0.0, dot(R, V)), fragSpecularPower);
 		Phong += Diffuse + Specular;
 	}
 
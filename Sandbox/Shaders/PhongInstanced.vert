@@ -0,0 +1,64 @@
+
+#version 430
+
+struct DirectionalLight
+{
+	vec3 direction;
+	vec3 diffuseColor;
+	vec3 specularColor;
+};
+
+// Shared with every program, filled once per frame by the renderer
+layout(std140, row_major) uniform FrameData
+{
+	mat4 ViewProj;
+	mat4 SpriteViewProj;
+	vec3 CameraPos;
+	vec3 AmbientLight;
+	DirectionalLight DirLight;
+};
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec2 inTexCoord;
+
+// Per instance, counts up from the draw's base instance so it indexes Instances directly
+layout(location = 3) in uint inDrawId;
+
+struct Instance
+{
+	mat4 world;
+	uint material;
+};
+
+// Filled by the renderer every frame, one entry per mesh drawn
+layout(std430, row_major) readonly buffer InstanceData
+{
+	Instance Instances[];
+};
+
+// x is the specular power
+layout(std430) readonly buffer MaterialData
+{
+	vec4 Materials[];
+};
+
+out vec2 fragTexCoord;
+out vec3 fragNormal;
+out vec3 fragWorldPos;
+flat out float fragSpecularPower;
+
+void main()
+{
+	Instance instance = Instances[inDrawId];
+
+	vec4 pos = vec4(inPosition, 1.0);
+	pos = pos * instance.world;
+	fragWorldPos = pos.xyz;
+	gl_Position = pos * ViewProj;
+
+	fragNormal = (vec4(inNormal, 0.0f) * instance.world).xyz;
+
+	fragTexCoord = inTexCoord;
+	fragSpecularPower = Materials[instance.material].x;
+}
\ No newline at end of file
@@ -1,19 +0,0 @@
-
-#version 330
-
-uniform mat4 WorldTransform;
-uniform mat4 ViewProj;
-
-layout(location = 0) in vec3 inPosition;
-layout(location = 1) in vec3 inNormal;
-layout(location = 2) in vec2 inTexCoord;
-
-out vec2 fragTexCoord;
-
-void main(){
-
-    vec4 pos = vec4(inPosition, 1.0);
-    gl_Position = pos * WorldTransform * ViewProj;
-
-    fragTexCoord = inTexCoord;
-}
\ No newline at end of file
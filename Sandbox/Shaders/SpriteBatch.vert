@@ -0,0 +1,31 @@
+#version 330
+
+struct DirectionalLight
+{
+    vec3 direction;
+    vec3 diffuseColor;
+    vec3 specularColor;
+};
+
+// Shared with every program, filled once per frame by the renderer
+layout(std140, row_major) uniform FrameData
+{
+    mat4 ViewProj;
+    mat4 SpriteViewProj;
+    vec3 CameraPos;
+    vec3 AmbientLight;
+    DirectionalLight DirLight;
+};
+
+// Corners arrive already in world space, the sprite batch applies the world transform on the CPU
+layout(location = 0) in vec2 inPosition;
+layout(location = 1) in vec2 inTexCoord;
+
+out vec2 fragTexCoord;
+
+void main(){
+
+    gl_Position = vec4(inPosition, 0.0, 1.0) * SpriteViewProj;
+
+    fragTexCoord = inTexCoord;
+}
\ No newline at end of file
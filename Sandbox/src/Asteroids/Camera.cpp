@@ -33,10 +33,12 @@ Camera::Camera()
     mMove = DBG_NEW MoveComponent{ this };
 }
 
-void Camera::UpdateEntity(f32 delta)
+// Built from the interpolated transform, a view from the last tick would judder against everything it looks at
+void Camera::UpdateView() const
 {
-    const vec3     camPos = Position();
-    const vec3     target = camPos + Forward() * 100.f;
+    const mat4&    world  = RenderTransform();
+    const vec3     camPos = world.Translation();
+    const vec3     target = camPos + world.XAxis() * 100.f;
     constexpr vec3 up     = math::unitz_vec3;
 
     const mat4 view = math::LookAt(camPos, target, up);
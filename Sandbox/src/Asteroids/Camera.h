@@ -30,7 +30,7 @@ class Camera : public retract::Entity
 {
 public:
     Camera();
-    void UpdateEntity(f32 delta) override;
+    void UpdateView() const;
     void EntityInput(const u8* keys) override;
 private:
     retract::MoveComponent* mMove{};
@@ -25,9 +25,31 @@
 
 
 #include "Retract/Components/Entity.h"
+#include "Retract/Physics/Collision.h"
 
 using namespace retract;
 
+Circle::Circle(Entity* owner) : Component{owner}
+{
+    m_collider = physics::AddCollider(owner);
+}
+
+Circle::~Circle()
+{
+    physics::RemoveCollider(m_collider);
+}
+
+void Circle::SetRadius(f32 radius)
+{
+    m_radius = radius;
+    physics::SetSphere(m_collider, Center(), Radius());
+}
+
+void Circle::OnUpdateWorldTransform()
+{
+    physics::SetSphere(m_collider, Center(), Radius());
+}
+
 f32 Circle::Radius() const
 {
     return mOwner->Scale() * m_radius;
@@ -35,7 +57,7 @@ f32 Circle::Radius() const
 
 vec3 Circle::Center() const
 {
-    return mOwner->Position();
+    return mOwner->WorldPosition();
 }
 
 bool Intersect(const Circle& a, const Circle& b)
@@ -24,18 +24,25 @@
 
 #include "Retract/Components/Component.h"
 
+// Thin wrapper around a physics collider, the broadphase is kept up to date through OnUpdateWorldTransform
 class Circle : public retract::Component
 {
 public:
-    Circle(retract::Entity* owner) : Component{owner} {}
+    Circle(retract::Entity* owner);
+    ~Circle() override;
 
-    void SetRadius(f32 radius) { m_radius = radius; }
+    void SetRadius(f32 radius);
     f32 Radius() const;
 
     vec3 Center() const;
 
+    void OnUpdateWorldTransform() override;
+
+    u32 Collider() const { return m_collider; }
+
 private:
     f32 m_radius{};
+    u32 m_collider{ u32_invalid_id };
 };
 
 
@@ -25,6 +25,7 @@
 
 #include "Plane.h"
 #include "Retract/Components/MeshComponent.h"
+#include "Retract/Components/Sprite.h"
 #include "Retract/Core/Resources.h"
 #include "Retract/Graphics/Renderer.h"
 
@@ -39,13 +40,13 @@ void Sandbox::Init()
     q = math::Concatinate(q, quaternion{math::unitz_vec3, math::pi + math::pi / 4.f});
     e->SetRotation(q);
     MeshComponent* mc = DBG_NEW MeshComponent{e};
-    mc->SetMesh(core::GetMesh("./Content/Cube.gpmesh"));
+    mc->SetMesh(core::GetMeshAsync("./Content/Cube.gpmesh"));
 
     e = DBG_NEW Entity{};
     e->SetPosition({200.f, -75.f, 0.f});
     e->SetScale(3.f);
     mc = DBG_NEW MeshComponent{e};
-    mc->SetMesh(core::GetMesh("./Content/Sphere.gpmesh"));
+    mc->SetMesh(core::GetMeshAsync("./Content/Sphere.gpmesh"));
 
     constexpr f32 start = -1250.f;
     constexpr f32 size = 250.f;
@@ -108,4 +109,10 @@ void Sandbox::Init()
     sc->SetTexture("./Content/Radar.png");
 
     LOG_DEBUG("Camera pos: {}, {}, {}", mCamera->Position().x, mCamera->Position().y, mCamera->Position().z);
-}
\ No newline at end of file
+}
+
+// Game already interpolated every transform with alpha, the camera's view comes from its interpolated transform
+void Sandbox::PreRender([[maybe_unused]] f32 alpha)
+{
+    mCamera->UpdateView();
+}
@@ -31,6 +31,7 @@ class Sandbox : public retract::Game
 {
 public:
     void Init() override;
+    void PreRender(f32 alpha) override;
 
 private:
     Camera* mCamera{};
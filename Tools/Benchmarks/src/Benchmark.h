@@ -0,0 +1,87 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Benchmark.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+
+#pragma once
+
+#include "Retract/Types.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+// Self registering benchmarks, run from Main by name
+//   BENCHMARK(parallel_for) { const f64 ms = bench::Time(5, [] { ... }); std::printf(...); }
+
+namespace bench
+{
+using BenchFunc = void (*)();
+
+struct Benchmark
+{
+    const char* name;
+    BenchFunc   func;
+};
+
+inline std::vector<Benchmark>& Registry()
+{
+    static std::vector<Benchmark> registry{};
+    return registry;
+}
+
+struct Registrar
+{
+    Registrar(const char* name, BenchFunc func) { Registry().emplace_back(Benchmark{ name, func }); }
+};
+
+// Best of repeats runs in milliseconds, the best run is the one least disturbed by the rest of the system
+template<typename Func>
+f64 Time(u32 repeats, Func&& func)
+{
+    f64 best = 1e30;
+    for (u32 i = 0; i < repeats; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const std::chrono::duration<f64, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        best                                                 = elapsed.count() < best ? elapsed.count() : best;
+    }
+    return best;
+}
+
+// Keeps the optimizer from discarding work whose result is otherwise unused
+template<typename T>
+void DoNotOptimize(const T& value)
+{
+    static const void* volatile sink{};
+    sink = &value;
+    (void) sink;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+} // namespace bench
+
+#define BENCHMARK(name)                                                                                                      \
+    static void bench_##name();                                                                                              \
+    static const bench::Registrar registrar_##name{ #name, bench_##name };                                                   \
+    static void bench_##name()
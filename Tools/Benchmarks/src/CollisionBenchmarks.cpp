@@ -0,0 +1,122 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: CollisionBenchmarks.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "Benchmark.h"
+
+#include "Retract/Components/Entity.h"
+#include "Retract/Core/Game.h"
+#include "Retract/Core/Jobs.h"
+#include "Retract/Physics/Collision.h"
+
+#include <cstdio>
+#include <random>
+
+using namespace retract;
+
+namespace
+{
+// Colliders need entities and entities register with the game, which is constructed but never run
+class HeadlessGame : public Game
+{
+public:
+    void Init() override {}
+};
+
+constexpr f32 radius      = 8.f;
+constexpr f32 cell_size   = 20.f;
+constexpr f32 spacing     = 25.f; // Average distance between neighbours, keeps the density the same at every count
+constexpr f32 speed       = 2.f;  // Per frame, well under a cell so most colliders keep their cells
+constexpr u32 warmup      = 10;
+constexpr u32 frame_count = 100;
+
+struct Mover
+{
+    vec3 position;
+    vec3 velocity;
+};
+
+void Run(u32 count)
+{
+    std::mt19937                        rng{ count };
+    const f32                           side = std::sqrt((f32) count) * spacing;
+    std::uniform_real_distribution<f32> place{ 0.f, side };
+    std::uniform_real_distribution<f32> direction{ -speed, speed };
+
+    utl::vector<Entity*> entities{};
+    utl::vector<u32>     colliders{};
+    utl::vector<Mover>   movers{};
+    for (u32 i = 0; i < count; ++i)
+    {
+        entities.emplace_back(new Entity{});
+        colliders.emplace_back(physics::AddCollider(entities.back(), radius));
+        movers.emplace_back(Mover{ vec3{ place(rng), place(rng), 0.f }, vec3{ direction(rng), direction(rng), 0.f } });
+    }
+
+    f64 total_ms{};
+    u64 total_pairs{};
+    for (u32 frame = 0; frame < warmup + frame_count; ++frame)
+    {
+        // Everything moves every frame, bouncing off the edges of the square
+        for (u32 i = 0; i < count; ++i)
+        {
+            Mover& m = movers[i];
+            m.position  += m.velocity;
+            m.velocity.x = m.position.x < 0.f || m.position.x > side ? -m.velocity.x : m.velocity.x;
+            m.velocity.y = m.position.y < 0.f || m.position.y > side ? -m.velocity.y : m.velocity.y;
+            physics::SetSphere(colliders[i], m.position, radius);
+        }
+
+        const f64 ms = bench::Time(1, [] { physics::Update(); });
+        if (frame >= warmup)
+        {
+            total_ms    += ms;
+            total_pairs += physics::Pairs().size();
+        }
+    }
+
+    std::printf("  %8u %10.3f %10llu\n", count, total_ms / frame_count, (unsigned long long) (total_pairs / frame_count));
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        physics::RemoveCollider(colliders[i]);
+        delete entities[i];
+    }
+}
+} // anonymous namespace
+
+// physics::Update with every collider moving each frame, 10k to 100k colliders at constant density
+BENCHMARK(collision_update)
+{
+    jobs::Initialize();
+    HeadlessGame game{};
+    physics::SetCellSize(cell_size);
+
+    std::printf("  %u workers, radius %.0f, cell %.0f\n", jobs::WorkerCount(), radius, cell_size);
+    std::printf("  %8s %10s %10s\n", "colliders", "ms/frame", "pairs");
+    for (const u32 count : { 10'000u, 25'000u, 50'000u, 100'000u })
+    {
+        Run(count);
+    }
+    jobs::Shutdown();
+}
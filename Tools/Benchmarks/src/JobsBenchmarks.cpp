@@ -0,0 +1,89 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: JobsBenchmarks.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "Benchmark.h"
+
+#include "Retract/Core/Jobs.h"
+
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+using namespace retract;
+
+namespace
+{
+constexpr u32 element_count = 1u << 22;
+constexpr u32 repeats       = 10;
+
+void Scale(u32 batch_size, u32 iterations)
+{
+    utl::vector<f32> values(element_count, 1.f);
+    f32*             data = values.data();
+
+    const u32 max_workers = math::Max(std::thread::hardware_concurrency(), 1u);
+    std::printf("  batch %u, %u iterations per element\n", batch_size, iterations);
+    std::printf("  %8s %10s %8s\n", "workers", "ms", "speedup");
+
+    f64 single{};
+    for (u32 workers = 1; workers <= max_workers; ++workers)
+    {
+        // One worker runs without a job system, ParallelFor then calls straight through
+        if (workers > 1)
+        {
+            jobs::Initialize(workers - 1);
+        }
+
+        const f64 ms = bench::Time(repeats, [data, batch_size, iterations] {
+            jobs::ParallelFor(element_count, batch_size, [data, iterations](u32 begin, u32 end) {
+                for (u32 i = begin; i < end; ++i)
+                {
+                    f32 v = data[i];
+                    for (u32 k = 0; k < iterations; ++k)
+                    {
+                        v = std::sqrt(v * 1.0001f + 0.5f);
+                    }
+                    data[i] = v;
+                }
+            });
+        });
+        bench::DoNotOptimize(data[element_count / 2]);
+
+        single = workers == 1 ? ms : single;
+        std::printf("  %8u %10.3f %7.2fx\n", workers, ms, single / ms);
+
+        if (workers > 1)
+        {
+            jobs::Shutdown();
+        }
+    }
+}
+} // anonymous namespace
+
+// Compute bound work at a typical batch size, then small batches of light work where queue overhead dominates
+BENCHMARK(parallel_for_scaling)
+{
+    Scale(4096, 16);
+    Scale(64, 1);
+}
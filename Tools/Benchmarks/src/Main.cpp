@@ -15,35 +15,34 @@
 //     See the License for the specific language governing permissions and
 //     limitations under the License.
 //
-//  File Name: VertexArray.h
-//  Date File Created: 08/24/2023
+//  File Name: Main.cpp
+//  Date File Created: 10/17/2026
 //  Author: Matt
 //
 //  ------------------------------------------------------------------------------
 
-#pragma once
 
-#include "Retract/Common.h"
+#pragma comment(lib, "Retract.lib")
 
-namespace retract
-{
-
-class VertexArray
-{
-public:
-    VertexArray(const std::vector<f32>& vertices, u32 num_verts, const std::vector<u32>& indices);
-    ~VertexArray();
+#include "Benchmark.h"
 
-    void Activate() const;
+#include <cstdio>
+#include <cstring>
 
-    constexpr u32 NumVerts() const { return mNumVerts; }
-    constexpr u32 NumIndices() const { return mNumIndices; }
-private:
-    u32 mNumVerts{};
-    u32 mNumIndices{};
-    u32 mVbo{};
-    u32 mIbo{};
-    u32 mVao{};
-};
+// Runs the registered benchmarks, build in Release for meaningful numbers
+//   Benchmarks            runs everything
+//   Benchmarks <filter>   runs the benchmarks whose name contains filter
 
-} // namespace retract
+int main(int argc, char** argv)
+{
+    const char* filter = argc > 1 ? argv[1] : "";
+    for (const auto& [name, func] : bench::Registry())
+    {
+        if (std::strstr(name, filter))
+        {
+            std::printf("== %s\n", name);
+            func();
+        }
+    }
+    return 0;
+}
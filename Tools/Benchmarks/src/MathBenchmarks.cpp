@@ -0,0 +1,126 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MathBenchmarks.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "Benchmark.h"
+
+#include "../../Tests/src/MathReference.h"
+
+#include <cstdio>
+#include <random>
+
+using namespace retract;
+
+// Engine math (SIMD where Math.h enables it) against the scalar reference the tests check it with
+
+namespace
+{
+constexpr u32 count   = 1u << 16;
+constexpr u32 repeats = 20;
+
+struct Inputs
+{
+    utl::vector<mat4>       matrices;
+    utl::vector<vec4>       vectors;
+    utl::vector<quaternion> rotations;
+};
+
+const Inputs& GetInputs()
+{
+    static const Inputs inputs = [] {
+        std::mt19937                        rng{ 42 };
+        std::uniform_real_distribution<f32> value{ -1.f, 1.f };
+
+        Inputs in{};
+        for (u32 i = 0; i < count; ++i)
+        {
+            const quaternion rotation{ Normalize(vec3{ value(rng), value(rng), value(rng) }), value(rng) * math::pi };
+            in.matrices.emplace_back(math::FromQuaternion(rotation) * math::Translation({ value(rng), value(rng), value(rng) }));
+            in.vectors.emplace_back(vec4{ value(rng), value(rng), value(rng), 1.f });
+            in.rotations.emplace_back(rotation);
+        }
+        return in;
+    }();
+    return inputs;
+}
+
+// Runs both over every input index and prints ns per call
+template<typename Engine, typename Reference>
+void Compare(const char* name, Engine&& engine, Reference&& reference)
+{
+    const f64 engine_ms = bench::Time(repeats, [&engine] {
+        for (u32 i = 0; i < count; ++i)
+        {
+            engine(i);
+        }
+    });
+    const f64 reference_ms = bench::Time(repeats, [&reference] {
+        for (u32 i = 0; i < count; ++i)
+        {
+            reference(i);
+        }
+    });
+
+    constexpr f64 ns_per_ms = 1e6 / count;
+    std::printf("  %-22s %8.2f %8.2f %7.2fx\n", name, engine_ms * ns_per_ms, reference_ms * ns_per_ms, reference_ms / engine_ms);
+}
+} // anonymous namespace
+
+BENCHMARK(math)
+{
+    const Inputs&     in   = GetInputs();
+    const mat4*       m    = in.matrices.data();
+    const vec4*       v    = in.vectors.data();
+    const quaternion* q    = in.rotations.data();
+    constexpr u32     mask = count - 1;
+
+    std::printf("  SSE %d, AVX %d\n", RETRACT_SIMD_SSE, RETRACT_SIMD_AVX);
+    std::printf("  %-22s %8s %8s %8s\n", "ns per call", "engine", "scalar", "speedup");
+
+    Compare(
+        "mat4 * mat4", [m](u32 i) { bench::DoNotOptimize(m[i] * m[(i + 1) & mask]); },
+        [m](u32 i) { bench::DoNotOptimize(reference::Multiply(m[i], m[(i + 1) & mask])); });
+    Compare(
+        "mat4 Invert",
+        [m](u32 i) {
+            mat4 inverse = m[i];
+            inverse.Invert();
+            bench::DoNotOptimize(inverse);
+        },
+        [m](u32 i) { bench::DoNotOptimize(reference::Invert(m[i])); });
+    Compare(
+        "mat4 Transpose", [m](u32 i) { bench::DoNotOptimize(math::Transpose(m[i])); },
+        [m](u32 i) { bench::DoNotOptimize(reference::Transpose(m[i])); });
+    Compare(
+        "vec3 Transform", [m, v](u32 i) { bench::DoNotOptimize(math::Transform(vec3{ v[i].x, v[i].y, v[i].z }, m[i])); },
+        [m, v](u32 i) { bench::DoNotOptimize(reference::Transform(vec3{ v[i].x, v[i].y, v[i].z }, m[i])); });
+    Compare(
+        "vec4 Transform", [m, v](u32 i) { bench::DoNotOptimize(math::Transform(v[i], m[i])); },
+        [m, v](u32 i) { bench::DoNotOptimize(reference::Transform(v[i], m[i])); });
+    Compare(
+        "quaternion Concatinate", [q](u32 i) { bench::DoNotOptimize(math::Concatinate(q[i], q[(i + 1) & mask])); },
+        [q](u32 i) { bench::DoNotOptimize(reference::Concatinate(q[i], q[(i + 1) & mask])); });
+    Compare(
+        "quaternion Slerp", [q](u32 i) { bench::DoNotOptimize(math::Slerp(q[i], q[(i + 1) & mask], 0.3f)); },
+        [q](u32 i) { bench::DoNotOptimize(reference::Slerp(q[i], q[(i + 1) & mask], 0.3f)); });
+}
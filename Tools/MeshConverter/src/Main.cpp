@@ -0,0 +1,99 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Main.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+#pragma comment(lib, "Retract.lib")
+
+#include "Retract/Graphics/MeshFormat.h"
+#include "Retract/Graphics/MeshOptimizer.h"
+
+#include <cstdio>
+#include <filesystem>
+
+// Converts .gpmesh json meshes into the binary .rmesh format the engine prefers at load time, optimizing their vertex
+// and triangle order and generating LODs on the way (see mesh_optimizer).
+//   MeshConverter <file.gpmesh> [out.rmesh]
+//   MeshConverter <directory>        converts every .gpmesh below it, next to the source
+
+using namespace retract;
+
+namespace
+{
+bool Convert(const std::filesystem::path& source, const std::filesystem::path& target)
+{
+    mesh_format::MeshSource mesh{};
+    if (!mesh_format::ReadGpMesh(source.string(), mesh))
+    {
+        std::printf("Failed to read %s\n", source.string().c_str());
+        return false;
+    }
+
+    const mesh_optimizer::OptimizeStats stats = mesh_optimizer::Optimize(mesh);
+
+    if (!mesh_format::WriteBinary(target.string(), mesh))
+    {
+        std::printf("Failed to write %s\n", target.string().c_str());
+        return false;
+    }
+
+    const u32  vertex_count = (u32) (mesh.vertices.size() / mesh_format::floats_per_vertex);
+    const bool packed       = mesh_format::ChooseVertexFormat(mesh) == graphics::mesh_buffer::VertexFormat::packed;
+    const bool short_index  = graphics::mesh_buffer::IndexTypeFor(vertex_count) == graphics::mesh_buffer::IndexType::u16;
+    std::printf("%s -> %s (%u vertices%s, %u indices%s)\n", source.string().c_str(), target.string().c_str(), vertex_count,
+                packed ? " packed" : "", (u32) mesh.indices.size(), short_index ? " 16 bit" : "");
+    std::printf("    %u -> %u vertices, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n", stats.vertices_before, stats.vertices_after,
+                stats.before.acmr, stats.after.acmr, stats.before.atvr, stats.after.atvr);
+    for (u32 i = 0; i < (u32) mesh.lods.size(); ++i)
+    {
+        std::printf("    LOD %u: %u indices, error %.4f of radius\n", i + 1, (u32) mesh.lods[i].indices.size(),
+                    mesh.lods[i].error);
+    }
+    return true;
+}
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::printf("Usage: %s <file.gpmesh | directory> [out.rmesh]\n", argv[0]);
+        return 1;
+    }
+
+    const std::filesystem::path input{ argv[1] };
+    if (std::filesystem::is_directory(input))
+    {
+        u32 failed = 0;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator{ input })
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ".gpmesh")
+            {
+                const std::filesystem::path target = mesh_format::BinaryPath(entry.path().string());
+                failed += Convert(entry.path(), target) ? 0 : 1;
+            }
+        }
+        return failed == 0 ? 0 : 1;
+    }
+
+    const std::filesystem::path target{ argc > 2 ? std::string{ argv[2] } : mesh_format::BinaryPath(input.string()) };
+    return Convert(input, target) ? 0 : 1;
+}
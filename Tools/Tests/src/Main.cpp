@@ -0,0 +1,59 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Main.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#pragma comment(lib, "Retract.lib")
+
+#include "Test.h"
+
+#include <cstdio>
+
+// Runs every registered test, the exit code is the number of failed tests
+//   Tests
+
+namespace
+{
+int failures{};
+} // anonymous namespace
+
+void tests::Fail(const char* file, int line, const char* expr)
+{
+    std::printf("  %s(%d): CHECK(%s) failed\n", file, line, expr);
+    ++failures;
+}
+
+int main()
+{
+    int failed{};
+    for (const auto& [name, func] : tests::Registry())
+    {
+        const int before = failures;
+        func();
+        const bool passed = failures == before;
+        failed += passed ? 0 : 1;
+        std::printf("[%s] %s\n", passed ? " ok " : "FAIL", name);
+    }
+
+    std::printf("%d/%d tests passed\n", (int) tests::Registry().size() - failed, (int) tests::Registry().size());
+    return failed;
+}
@@ -0,0 +1,150 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MathReference.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+
+#pragma once
+
+#include "Retract/Common.h"
+
+#include <cmath>
+
+// Plain scalar versions of the math functions that have SIMD paths, written from the definitions rather than copied
+// from the engine. Sums go in the same order as the engine's scalar paths, so results that are exact there are exact
+// here. MathTests compares the engine against them, Benchmarks times them as the scalar baseline
+namespace reference
+{
+using namespace retract;
+
+inline mat4 Multiply(const mat4& a, const mat4& b)
+{
+    mat4 ret{};
+    for (u32 i = 0; i < 4; ++i)
+    {
+        for (u32 j = 0; j < 4; ++j)
+        {
+            ret.mat[i][j] = a.mat[i][0] * b.mat[0][j] + a.mat[i][1] * b.mat[1][j] + a.mat[i][2] * b.mat[2][j] +
+                            a.mat[i][3] * b.mat[3][j];
+        }
+    }
+    return ret;
+}
+
+inline mat4 Transpose(const mat4& m)
+{
+    mat4 ret{};
+    for (u32 i = 0; i < 4; ++i)
+    {
+        for (u32 j = 0; j < 4; ++j)
+        {
+            ret.mat[i][j] = m.mat[j][i];
+        }
+    }
+    return ret;
+}
+
+// Adjugate over determinant, the cofactors built from the twelve 2x2 determinants of the top and bottom row pairs
+inline mat4 Invert(const mat4& m)
+{
+    const auto& a = m.mat;
+
+    const f32 s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+    const f32 s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+    const f32 s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+    const f32 s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+    const f32 s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+    const f32 s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+
+    const f32 c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+    const f32 c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+    const f32 c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+    const f32 c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+    const f32 c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+    const f32 c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+
+    const f32 inv_det = 1.f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    f32 r[4][4] = {
+        { a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3, -a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3,
+          a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3, -a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3 },
+        { -a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1, a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1,
+          -a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1, a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1 },
+        { a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0, -a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0,
+          a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0, -a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0 },
+        { -a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0, a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0,
+          -a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0, a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0 },
+    };
+    for (auto& row : r)
+    {
+        for (f32& v : row)
+        {
+            v *= inv_det;
+        }
+    }
+    return { r };
+}
+
+inline vec3 Transform(const vec3& v, const mat4& m, f32 w = 1.f)
+{
+    return { v.x * m.mat[0][0] + v.y * m.mat[1][0] + v.z * m.mat[2][0] + w * m.mat[3][0],
+             v.x * m.mat[0][1] + v.y * m.mat[1][1] + v.z * m.mat[2][1] + w * m.mat[3][1],
+             v.x * m.mat[0][2] + v.y * m.mat[1][2] + v.z * m.mat[2][2] + w * m.mat[3][2] };
+}
+
+inline vec4 Transform(const vec4& v, const mat4& m)
+{
+    return { v.x * m.mat[0][0] + v.y * m.mat[1][0] + v.z * m.mat[2][0] + v.w * m.mat[3][0],
+             v.x * m.mat[0][1] + v.y * m.mat[1][1] + v.z * m.mat[2][1] + v.w * m.mat[3][1],
+             v.x * m.mat[0][2] + v.y * m.mat[1][2] + v.z * m.mat[2][2] + v.w * m.mat[3][2],
+             v.x * m.mat[0][3] + v.y * m.mat[1][3] + v.z * m.mat[2][3] + v.w * m.mat[3][3] };
+}
+
+// Hamilton product p * q, q applied first
+inline quaternion Concatinate(const quaternion& q, const quaternion& p)
+{
+    return { p.w * q.x + q.w * p.x + (p.y * q.z - p.z * q.y), p.w * q.y + q.w * p.y + (p.z * q.x - p.x * q.z),
+             p.w * q.z + q.w * p.z + (p.x * q.y - p.y * q.x), p.w * q.w - (p.x * q.x + p.y * q.y + p.z * q.z) };
+}
+
+inline quaternion Slerp(const quaternion& a, const quaternion& b, f32 f)
+{
+    const f32 raw_cos = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    const f32 cos     = std::abs(raw_cos);
+
+    f32 scale0 = 1.f - f;
+    f32 scale1 = f;
+    if (cos < 0.9999f)
+    {
+        const f32 omega   = std::acos(cos);
+        const f32 inv_sin = 1.f / std::sin(omega);
+        scale0            = std::sin((1.f - f) * omega) * inv_sin;
+        scale1            = std::sin(f * omega) * inv_sin;
+    }
+    scale1 = raw_cos < 0.f ? -scale1 : scale1;
+
+    const quaternion ret{ scale0 * a.x + scale1 * b.x, scale0 * a.y + scale1 * b.y, scale0 * a.z + scale1 * b.z,
+                          scale0 * a.w + scale1 * b.w };
+    const f32        length = std::sqrt(ret.x * ret.x + ret.y * ret.y + ret.z * ret.z + ret.w * ret.w);
+    return { ret.x / length, ret.y / length, ret.z / length, ret.w / length };
+}
+} // namespace reference
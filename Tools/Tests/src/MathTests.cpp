@@ -0,0 +1,201 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: MathTests.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "Test.h"
+
+#include "MathReference.h"
+
+#include <random>
+
+using namespace retract;
+
+// The engine is built with whatever SIMD level the compiler allows (see Math.h), these check those paths against
+// the plain scalar math in MathReference.h on random input
+
+namespace
+{
+constexpr u32 iterations = 1000;
+
+bool Near(f32 a, f32 b, f32 tolerance)
+{
+    return std::abs(a - b) <= tolerance * math::Max(1.f, math::Max(std::abs(a), std::abs(b)));
+}
+
+bool Near(const mat4& a, const mat4& b, f32 tolerance)
+{
+    for (u32 i = 0; i < 4; ++i)
+    {
+        for (u32 j = 0; j < 4; ++j)
+        {
+            if (!Near(a.mat[i][j], b.mat[i][j], tolerance))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool Near(const vec4& a, const vec4& b, f32 tolerance)
+{
+    return Near(a.x, b.x, tolerance) && Near(a.y, b.y, tolerance) && Near(a.z, b.z, tolerance) && Near(a.w, b.w, tolerance);
+}
+
+bool Near(const vec3& a, const vec3& b, f32 tolerance)
+{
+    return Near(a.x, b.x, tolerance) && Near(a.y, b.y, tolerance) && Near(a.z, b.z, tolerance);
+}
+
+class Random
+{
+public:
+    explicit Random(u32 seed) : mRng{ seed } {}
+
+    f32  Float(f32 min = -10.f, f32 max = 10.f) { return std::uniform_real_distribution<f32>{ min, max }(mRng); }
+    vec3 Vec3() { return { Float(), Float(), Float() }; }
+    vec4 Vec4() { return { Float(), Float(), Float(), Float() }; }
+
+    mat4 Matrix()
+    {
+        mat4 m{};
+        for (auto& row : m.mat)
+        {
+            for (f32& v : row)
+            {
+                v = Float();
+            }
+        }
+        return m;
+    }
+
+    quaternion Rotation() { return { Normalize(Vec3()), Float(-math::pi, math::pi) }; }
+
+    // Scale, rotation and translation, the kind of matrix the engine inverts, never close to singular
+    mat4 Transform() { return math::Scale(Float(0.5f, 4.f)) * math::FromQuaternion(Rotation()) * math::Translation(Vec3()); }
+
+private:
+    std::mt19937 mRng;
+};
+} // anonymous namespace
+
+TEST(math_matrix_multiply)
+{
+    Random random{ 1 };
+    for (u32 i = 0; i < iterations; ++i)
+    {
+        const mat4 a = random.Matrix();
+        const mat4 b = random.Matrix();
+        CHECK(Near(a * b, reference::Multiply(a, b), 1e-6f));
+
+        mat4 c = a;
+        c *= b;
+        CHECK(Near(c, reference::Multiply(a, b), 1e-6f));
+    }
+}
+
+TEST(math_matrix_transpose)
+{
+    Random random{ 2 };
+    for (u32 i = 0; i < iterations; ++i)
+    {
+        const mat4 m = random.Matrix();
+        CHECK(Near(math::Transpose(m), reference::Transpose(m), 0.f));
+    }
+}
+
+TEST(math_matrix_invert)
+{
+    Random random{ 3 };
+    for (u32 i = 0; i < iterations; ++i)
+    {
+        const mat4 m       = random.Transform();
+        mat4       inverse = m;
+        inverse.Invert();
+        CHECK(Near(inverse, reference::Invert(m), 1e-4f));
+        CHECK(Near(m * inverse, math::identity_mat4, 1e-4f));
+    }
+
+    // Perspective projections are inverted to unproject, far from orthonormal
+    const mat4 projection = math::Perspective(math::ToRadians(70.f), 1280.f, 720.f, 0.1f, 10000.f);
+    mat4       inverse    = projection;
+    inverse.Invert();
+    CHECK(Near(inverse, reference::Invert(projection), 1e-4f));
+}
+
+TEST(math_vector_transform)
+{
+    Random random{ 4 };
+    for (u32 i = 0; i < iterations; ++i)
+    {
+        const mat4 m  = random.Matrix();
+        const vec3 v  = random.Vec3();
+        const vec4 v4 = random.Vec4();
+        CHECK(Near(math::Transform(v, m), reference::Transform(v, m), 1e-6f));
+        CHECK(Near(math::Transform(v, m, 0.f), reference::Transform(v, m, 0.f), 1e-6f));
+        CHECK(Near(math::Transform(v4, m), reference::Transform(v4, m), 1e-6f));
+    }
+}
+
+TEST(math_quaternion_concatinate)
+{
+    Random random{ 5 };
+    for (u32 i = 0; i < iterations; ++i)
+    {
+        const quaternion q = random.Rotation();
+        const quaternion p = random.Rotation();
+        CHECK(Near(math::Concatinate(q, p), reference::Concatinate(q, p), 1e-6f));
+    }
+
+    // Rotating by q then p has to match the matrices multiplied in the same order
+    const quaternion q = random.Rotation();
+    const quaternion p = random.Rotation();
+    CHECK(Near(math::FromQuaternion(math::Concatinate(q, p)), math::FromQuaternion(q) * math::FromQuaternion(p), 1e-5f));
+}
+
+TEST(math_quaternion_slerp)
+{
+    Random random{ 6 };
+    for (u32 i = 0; i < iterations; ++i)
+    {
+        const quaternion a = random.Rotation();
+        const quaternion b = random.Rotation();
+        const f32        f = random.Float(0.f, 1.f);
+        CHECK(Near(math::Slerp(a, b, f), reference::Slerp(a, b, f), 1e-5f));
+    }
+
+    // Nearly equal rotations take the lerp branch
+    const quaternion a = random.Rotation();
+    CHECK(Near(math::Slerp(a, a, 0.5f), reference::Slerp(a, a, 0.5f), 1e-6f));
+}
+
+TEST(math_sqrt)
+{
+    static_assert(math::Sqrt(0.f) == 0.f && math::Sqrt(4.f) == 2.f && math::Sqrt(1e-6f) == 1e-3f);
+
+    // The constant evaluated path has to agree with std::sqrt from denormals up to the largest floats
+    for (f32 x = 1e-40f; x < 1e38f; x *= 1.0137f)
+    {
+        CHECK((f32) math::SqrtNewton(x, x, 0.0) == std::sqrt(x));
+        CHECK(math::Sqrt(x) == std::sqrt(x));
+    }
+    CHECK(math::Sqrt(1e-12f) == 1e-6f);
+}
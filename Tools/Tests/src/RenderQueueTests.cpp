@@ -0,0 +1,141 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: RenderQueueTests.cpp
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+#include "Test.h"
+
+#include "Retract/Graphics/RenderQueue.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace retract;
+using namespace retract::graphics;
+
+namespace
+{
+// Few distinct shaders, textures and meshes so the keys collide the way a real frame's do and stability matters
+RenderQueue RandomQueue(u32 count, u32 seed, utl::vector<RenderQueue::Item>& items)
+{
+    std::mt19937                       rng{ seed };
+    std::uniform_int_distribution<u32> small{ 0, 3 };
+    std::uniform_int_distribution<u32> any{};
+    std::uniform_int_distribution<i32> order{ -4, 4 };
+
+    RenderQueue queue{};
+    items.clear();
+    for (u32 i = 0; i < count; ++i)
+    {
+        const u64 key = any(rng) & 1 ? draw_key::Mesh(small(rng), small(rng), small(rng), small(rng), small(rng))
+                                     : draw_key::Sprite(order(rng), small(rng), small(rng));
+        queue.Submit(key, i);
+        items.emplace_back(RenderQueue::Item{ key, i });
+    }
+    return queue;
+}
+
+bool SameOrder(const RenderQueue& queue, const utl::vector<RenderQueue::Item>& expected)
+{
+    if (queue.Size() != (u32) expected.size())
+    {
+        return false;
+    }
+    for (u32 i = 0; i < queue.Size(); ++i)
+    {
+        if (queue[i].key != expected[i].key || queue[i].index != expected[i].index)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // anonymous namespace
+
+TEST(render_queue_sort_matches_stable_sort)
+{
+    utl::vector<RenderQueue::Item> expected{};
+    for (u32 seed = 0; seed < 16; ++seed)
+    {
+        for (const u32 count : { 0u, 1u, 2u, 17u, 1000u, 20000u })
+        {
+            RenderQueue queue = RandomQueue(count, seed, expected);
+            queue.Sort();
+            std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.key < b.key; });
+            CHECK(SameOrder(queue, expected));
+        }
+    }
+}
+
+TEST(render_queue_sort_full_width_keys)
+{
+    // Every byte differs between keys, no pass can be skipped
+    std::mt19937_64                rng{ 7 };
+    utl::vector<RenderQueue::Item> expected{};
+    RenderQueue                    queue{};
+    for (u32 i = 0; i < 5000; ++i)
+    {
+        const u64 key = rng();
+        queue.Submit(key, i);
+        expected.emplace_back(RenderQueue::Item{ key, i });
+    }
+    queue.Sort();
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.key < b.key; });
+    CHECK(SameOrder(queue, expected));
+}
+
+TEST(render_queue_first)
+{
+    utl::vector<RenderQueue::Item> items{};
+    RenderQueue                    queue = RandomQueue(500, 3, items);
+    queue.Sort();
+
+    const u32 first_sprite = queue.First(draw_key::Pass::sprite);
+    CHECK(queue.First(draw_key::Pass::opaque) == 0);
+    for (u32 i = 0; i < queue.Size(); ++i)
+    {
+        CHECK((draw_key::GetPass(queue[i].key) == draw_key::Pass::sprite) == (i >= first_sprite));
+    }
+
+    RenderQueue opaque_only{};
+    opaque_only.Submit(draw_key::Mesh(1, 1, 1, 0, 1), 0);
+    opaque_only.Sort();
+    CHECK(opaque_only.First(draw_key::Pass::sprite) == opaque_only.Size());
+}
+
+TEST(draw_key_mesh_fields)
+{
+    // Each field saturated on its own must not spill into its neighbours
+    constexpr u64 shader  = draw_key::Mesh(~0u, 0, 0, 0, 0);
+    constexpr u64 texture = draw_key::Mesh(0, ~0u, 0, 0, 0);
+    constexpr u64 mesh    = draw_key::Mesh(0, 0, ~0u, 0, 0);
+    constexpr u64 lod     = draw_key::Mesh(0, 0, 0, ~0u, 0);
+    constexpr u64 depth   = draw_key::Mesh(0, 0, 0, 0, ~0u);
+    CHECK((shader & texture) == 0 && (texture & mesh) == 0 && (mesh & lod) == 0 && (lod & depth) == 0);
+    CHECK((shader | texture | mesh | lod | depth) == 0x0fff'ffff'ffff'ffffull);
+    CHECK(draw_key::GetPass(shader | texture | mesh | lod | depth) == draw_key::Pass::opaque);
+
+    // Meshes sharing state sort by mesh id, then LOD, then depth
+    CHECK(draw_key::Mesh(1, 1, 2, 0, 0) > draw_key::Mesh(1, 1, 1, 3, ~0u));
+    CHECK(draw_key::Mesh(1, 1, 1, 1, 0) > draw_key::Mesh(1, 1, 1, 0, ~0u));
+    CHECK(draw_key::Sprite(-0x8000, 0, 0) > draw_key::Mesh(~0u, ~0u, ~0u, ~0u, ~0u));
+}
@@ -0,0 +1,69 @@
+﻿//  ------------------------------------------------------------------------------
+//
+//  RetractEngine
+//     Copyright 2023 Matthew Rogers
+//
+//     Licensed under the Apache License, Version 2.0 (the "License");
+//     you may not use this file except in compliance with the License.
+//     You may obtain a copy of the License at
+//
+//         http://www.apache.org/licenses/LICENSE-2.0
+//
+//     Unless required by applicable law or agreed to in writing, software
+//     distributed under the License is distributed on an "AS IS" BASIS,
+//     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//     See the License for the specific language governing permissions and
+//     limitations under the License.
+//
+//  File Name: Test.h
+//  Date File Created: 10/17/2026
+//  Author: Matt
+//
+//  ------------------------------------------------------------------------------
+
+
+
+#pragma once
+
+#include <vector>
+
+// Minimal self registering tests. A TEST body runs once from Main, CHECK records a failure and keeps going
+//   TEST(render_queue_sort) { CHECK(a == b); }
+
+namespace tests
+{
+using TestFunc = void (*)();
+
+struct TestCase
+{
+    const char* name;
+    TestFunc    func;
+};
+
+inline std::vector<TestCase>& Registry()
+{
+    static std::vector<TestCase> registry{};
+    return registry;
+}
+
+struct Registrar
+{
+    Registrar(const char* name, TestFunc func) { Registry().emplace_back(TestCase{ name, func }); }
+};
+
+void Fail(const char* file, int line, const char* expr);
+} // namespace tests
+
+#define TEST(name)                                                                                                           \
+    static void test_##name();                                                                                               \
+    static const tests::Registrar registrar_##name{ #name, test_##name };                                                    \
+    static void test_##name()
+
+#define CHECK(expr)                                                                                                          \
+    do                                                                                                                       \
+    {                                                                                                                        \
+        if (!(expr))                                                                                                         \
+        {                                                                                                                    \
+            tests::Fail(__FILE__, __LINE__, #expr);                                                                          \
+        }                                                                                                                    \
+    } while (false)